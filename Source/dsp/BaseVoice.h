@@ -1,6 +1,15 @@
 #pragma once
 #include "params/ParameterSnapshot.h"
 
+// Per-note expression (MPE): bend in semitones, pressure and timbre
+// in 0…1. Timbre rests at 0.5 (MPE's CC74 centre).
+struct NoteExpression
+{
+    float bendSemis = 0.0f;
+    float pressure  = 0.0f;
+    float timbre    = 0.5f;
+};
+
 // Base class for all voice implementations (e.g. VoiceLegacy, VoiceA, etc.)
 class BaseVoice {
 public:
@@ -25,8 +34,23 @@ public:
     virtual int   getNote() const noexcept = 0;
     virtual float getCurrentLevel() const = 0;
 
+    // Samples the last render() actually computed (CPU instrumentation).
+    // -1 = not tracked: the voice renders whole blocks while active.
+    virtual int getSamplesRendered() const noexcept { return -1; }
+
+    // Per-note expression from VoiceManager's MPE dispatcher.
+    // `immediate` snaps (note start) instead of smoothing.
+    // Voices without expression ignore it.
+    virtual void setExpression(const NoteExpression& expression, bool immediate)
+    {
+        (void)expression;
+        (void)immediate;
+    }
+
     // ============================================================
-    // Diagnostic stub for per-voice MIDI CC handling
+    // Voice controls 3–8 (numbered after their factory CCs; the
+    // ControllerMap decides which CC drives which control). `norm`
+    // is the shaped 0…1 position.
     // ============================================================
     virtual void handleController(int cc, float norm)
     {
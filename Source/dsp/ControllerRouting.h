@@ -0,0 +1,368 @@
+#pragma once
+#include "dsp/DspTables.h"
+#include "params/ParameterIDs.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+// ============================================================
+// ControllerRouting — the one CC → parameter table
+// ------------------------------------------------------------
+// ControllerMap holds a route per controller number: a target
+// (host parameter and/or voice control), a response curve and a
+// sub-range of the target's travel. It is the only place CC numbers
+// appear; the processor, VoiceManager and the voices all dispatch on
+// the target.
+//
+// Default (factory) map, all linear over the full range:
+//
+//   CC1  master/volume   host
+//   CC2  master/mix      host
+//   CC3  env/attack      host + engine cache + voice control 3
+//   CC4  env/release     host + engine cache + voice control 4
+//   CC5  osc/freq        host + engine cache + voice control 5
+//   CC6–CC8              voice controls 6–8 (voice-defined)
+//
+// Maps are edited as values on the message thread (MIDI learn, state
+// restore) and published through ControllerMapExchange; the audio
+// thread picks up the new table at the next block without locking.
+//
+// ControllerCoalescer keeps only the latest value per controller
+// during a block, so a knob sweep of N messages on one CC costs one
+// mapping and one voice fan-out per sub-block.
+// ============================================================
+
+enum class CcTarget : uint8_t
+{
+    None,
+    MasterVolume,
+    MasterMix,
+    EnvAttack,
+    EnvRelease,
+    OscFreq,
+    VoiceControl6,
+    VoiceControl7,
+    VoiceControl8,
+};
+
+inline constexpr int numCcTargets = 9;
+
+enum class CcCurve : uint8_t
+{
+    Linear,
+    Squared,   // fine control at the bottom of the travel
+    Root,      // fine control at the top of the travel
+};
+
+inline constexpr int numCcCurves = 3;
+
+// Voice control number a target drives (the voices' historical CC
+// numbering), or -1 for targets voices never see.
+inline constexpr int voiceControlFor(CcTarget t) noexcept
+{
+    switch (t)
+    {
+        case CcTarget::EnvAttack:     return 3;
+        case CcTarget::EnvRelease:    return 4;
+        case CcTarget::OscFreq:       return 5;
+        case CcTarget::VoiceControl6: return 6;
+        case CcTarget::VoiceControl7: return 7;
+        case CcTarget::VoiceControl8: return 8;
+        default:                      return -1;
+    }
+}
+
+// Stable names for state serialisation; host targets reuse their
+// parameter IDs.
+inline const char* ccTargetName(CcTarget t) noexcept
+{
+    switch (t)
+    {
+        case CcTarget::MasterVolume:  return ParameterIDs::masterVolume;
+        case CcTarget::MasterMix:     return ParameterIDs::masterMix;
+        case CcTarget::EnvAttack:     return ParameterIDs::envAttack;
+        case CcTarget::EnvRelease:    return ParameterIDs::envRelease;
+        case CcTarget::OscFreq:       return ParameterIDs::oscFreq;
+        case CcTarget::VoiceControl6: return "voice/control6";
+        case CcTarget::VoiceControl7: return "voice/control7";
+        case CcTarget::VoiceControl8: return "voice/control8";
+        default:                      return "none";
+    }
+}
+
+inline bool findCcTarget(std::string_view name, CcTarget& out) noexcept
+{
+    for (int i = 0; i < numCcTargets; ++i)
+    {
+        if (name == ccTargetName(static_cast<CcTarget>(i)))
+        {
+            out = static_cast<CcTarget>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+inline const char* ccCurveName(CcCurve c) noexcept
+{
+    switch (c)
+    {
+        case CcCurve::Squared: return "squared";
+        case CcCurve::Root:    return "root";
+        default:               return "linear";
+    }
+}
+
+inline bool findCcCurve(std::string_view name, CcCurve& out) noexcept
+{
+    for (int i = 0; i < numCcCurves; ++i)
+    {
+        if (name == ccCurveName(static_cast<CcCurve>(i)))
+        {
+            out = static_cast<CcCurve>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+struct CcRoute
+{
+    CcTarget target = CcTarget::None;
+    CcCurve  curve  = CcCurve::Linear;
+    float    lo     = 0.0f;   // target position at controller 0
+    float    hi     = 1.0f;   // target position at controller 127 (lo > hi inverts)
+
+    // Controller position (0…1) → target position (0…1).
+    float shape(float norm) const noexcept
+    {
+        float n = norm < 0.0f ? 0.0f : (norm > 1.0f ? 1.0f : norm);
+
+        if (curve == CcCurve::Squared)   n = n * n;
+        else if (curve == CcCurve::Root) n = std::sqrt(n);
+
+        return lo + (hi - lo) * n;
+    }
+
+    bool operator==(const CcRoute& o) const noexcept
+    {
+        return target == o.target && curve == o.curve && lo == o.lo && hi == o.hi;
+    }
+    bool operator!=(const CcRoute& o) const noexcept { return !(*this == o); }
+};
+
+// Target position → engine units for the cached targets, through the
+// DspTables exp2 table rather than std::pow per message. Voices use
+// the same curves for their controls 3/4.
+namespace ControllerCurves
+{
+    inline constexpr float attackLo       = 0.001f;
+    inline constexpr float attackOctaves  = 10.965784284662087f;   // log2(2 s / 1 ms)
+    inline constexpr float releaseLo      = 0.020f;
+    inline constexpr float releaseOctaves = 7.965784284662087f;    // log2(5 s / 20 ms)
+    inline constexpr float oscFreqLo      = -560.0f;
+    inline constexpr float oscFreqSpan    = 2000.0f;
+
+    inline float exponential(float lo, float octaves, float norm) noexcept
+    {
+        return lo * DspTables::get().exp2(octaves * norm);
+    }
+
+    inline float attackSeconds(float norm) noexcept  { return exponential(attackLo, attackOctaves, norm); }
+    inline float releaseSeconds(float norm) noexcept { return exponential(releaseLo, releaseOctaves, norm); }
+    inline float oscFreqHz(float norm) noexcept      { return oscFreqLo + oscFreqSpan * norm; }
+}
+
+// ============================================================
+// ControllerMap — value type, edited on the message thread
+// ============================================================
+class ControllerMap {
+public:
+    static constexpr int numControllers = 128;
+
+    static ControllerMap makeDefault() noexcept
+    {
+        ControllerMap m;
+        m.learn(1, CcTarget::MasterVolume);
+        m.learn(2, CcTarget::MasterMix);
+        m.learn(3, CcTarget::EnvAttack);
+        m.learn(4, CcTarget::EnvRelease);
+        m.learn(5, CcTarget::OscFreq);
+        m.learn(6, CcTarget::VoiceControl6);
+        m.learn(7, CcTarget::VoiceControl7);
+        m.learn(8, CcTarget::VoiceControl8);
+        return m;
+    }
+
+    static bool isValidController(int cc) noexcept { return cc >= 0 && cc < numControllers; }
+
+    const CcRoute& route(int cc) const noexcept { return routes_[static_cast<size_t>(cc)]; }
+
+    void setRoute(int cc, const CcRoute& r) noexcept
+    {
+        if (isValidController(cc))
+            routes_[static_cast<size_t>(cc)] = r;
+    }
+
+    void clearRoute(int cc) noexcept { setRoute(cc, CcRoute {}); }
+
+    // MIDI learn: `cc` takes over `target` (full range, linear) and
+    // any controller previously bound to it is released.
+    void learn(int cc, CcTarget target) noexcept
+    {
+        if (!isValidController(cc))
+            return;
+
+        if (target != CcTarget::None)
+            for (auto& r : routes_)
+                if (r.target == target)
+                    r = CcRoute {};
+
+        routes_[static_cast<size_t>(cc)] = CcRoute { target };
+    }
+
+    // First controller bound to `target`, or -1.
+    int controllerFor(CcTarget target) const noexcept
+    {
+        for (int cc = 0; cc < numControllers; ++cc)
+            if (routes_[static_cast<size_t>(cc)].target == target)
+                return cc;
+        return -1;
+    }
+
+    bool operator==(const ControllerMap& o) const noexcept { return routes_ == o.routes_; }
+    bool operator!=(const ControllerMap& o) const noexcept { return !(*this == o); }
+
+private:
+    std::array<CcRoute, numControllers> routes_ {};
+};
+
+// ============================================================
+// ControllerMapExchange — RCU publication of ControllerMap
+// ------------------------------------------------------------
+// publish() (message thread) copies the map into a new heap node and
+// swaps the pointer; the audio thread's acquire() is two atomic loads
+// and a store. acquire() also records the node it returned, which
+// publish() never frees — so the audio thread may keep using that
+// reference until its next acquire(). Superseded nodes are reclaimed
+// by later publish() / collect() calls once the reader has moved on.
+// ============================================================
+class ControllerMapExchange {
+public:
+    ControllerMapExchange() { publish(ControllerMap::makeDefault()); }
+
+    ControllerMapExchange(const ControllerMapExchange&) = delete;
+    ControllerMapExchange& operator=(const ControllerMapExchange&) = delete;
+
+    // Message thread.
+    void publish(const ControllerMap& map)
+    {
+        std::lock_guard<std::mutex> lock(writerLock_);
+
+        nodes_.push_back(std::make_unique<ControllerMap>(map));
+        current_.store(nodes_.back().get());
+        collectLocked();
+    }
+
+    // Message thread: a copy of the most recently published map.
+    ControllerMap current() const
+    {
+        std::lock_guard<std::mutex> lock(writerLock_);
+        return *current_.load();
+    }
+
+    // Message thread: frees nodes the audio thread can no longer see.
+    void collect()
+    {
+        std::lock_guard<std::mutex> lock(writerLock_);
+        collectLocked();
+    }
+
+    // Audio thread (single reader). Valid until the next acquire().
+    const ControllerMap& acquire() noexcept
+    {
+        const ControllerMap* p = current_.load();
+        for (;;)
+        {
+            reading_.store(p);
+            const ControllerMap* again = current_.load();
+            if (again == p)
+                return *p;
+            p = again;   // a publish raced us; p may already be gone
+        }
+    }
+
+    // Nodes still allocated (current + not yet reclaimed).
+    size_t numNodes() const
+    {
+        std::lock_guard<std::mutex> lock(writerLock_);
+        return nodes_.size();
+    }
+
+private:
+    void collectLocked()
+    {
+        const ControllerMap* keep  = current_.load();
+        const ControllerMap* inUse = reading_.load();
+
+        nodes_.erase(std::remove_if(nodes_.begin(), nodes_.end(), [&](const auto& n)
+        {
+            return n.get() != keep && n.get() != inUse;
+        }), nodes_.end());
+    }
+
+    std::atomic<const ControllerMap*> current_ { nullptr };
+    std::atomic<const ControllerMap*> reading_ { nullptr };
+
+    mutable std::mutex writerLock_;
+    std::vector<std::unique_ptr<ControllerMap>> nodes_;   // writer side only
+};
+
+// ============================================================
+// ControllerCoalescer — latest value per CC (audio thread)
+// ============================================================
+class ControllerCoalescer {
+public:
+    static constexpr int numControllers = ControllerMap::numControllers;
+
+    void push(int cc, float norm) noexcept
+    {
+        const auto i = static_cast<size_t>(cc);
+        pending_[i] = norm;
+
+        if (!dirty_[i])
+        {
+            dirty_[i] = true;
+            order_[static_cast<size_t>(numDirty_++)] = static_cast<uint8_t>(cc);
+        }
+    }
+
+    bool hasPending() const noexcept { return numDirty_ > 0; }
+
+    // Calls fn(cc, lastValue) once per controller touched since the
+    // last flush, in first-arrival order.
+    template <typename Fn>
+    void flush(Fn&& fn)
+    {
+        for (int k = 0; k < numDirty_; ++k)
+        {
+            const int cc = order_[static_cast<size_t>(k)];
+            dirty_[static_cast<size_t>(cc)] = false;
+            fn(cc, pending_[static_cast<size_t>(cc)]);
+        }
+        numDirty_ = 0;
+    }
+
+private:
+    std::array<float,   numControllers> pending_ {};
+    std::array<bool,    numControllers> dirty_ {};
+    std::array<uint8_t, numControllers> order_ {};
+    int numDirty_ = 0;
+};
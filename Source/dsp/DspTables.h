@@ -0,0 +1,425 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "params/ParameterSnapshot.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// ============================================================
+// DspTables — process-wide registry of immutable lookup tables
+// ------------------------------------------------------------
+// One instance per process, built on the first get() (function-
+// local static, so concurrent first calls are safe) and never
+// written again. Every table starts on a 64-byte boundary inside
+// one contiguous blob:
+//
+//   sine       one cycle, sineSize + 1 points (SineTable)
+//   noteHz     MIDI note 0 … 127 → Hz, A4 = 440
+//   dbGain     −120 … +24 dB in 0.25 dB steps → linear gain
+//   exp2       2^x for x ∈ [0, 1], exp2Size + 1 points
+//   velocity   numVelocityCurves × 128 MIDI velocity steps → gain
+//   wavetable  numShapes × numMips rows of wtRowStride (WavetableSet)
+//
+// Persistence is optional: when setCacheFile() is called before the
+// first get(), the blob is memory-mapped from that file if its header
+// (magic, version, layout, checksum) matches; otherwise it is computed
+// and written back for the next process. A plugin scan then maps
+// ~0.4 MB instead of summing ~8M wavetable harmonics.
+// ============================================================
+
+class DspTables {
+public:
+    // ------------------------------------------------------------
+    // Layout
+    // ------------------------------------------------------------
+    static constexpr int sineBits = 11;
+    static constexpr int sineSize = 1 << sineBits;            // 2048
+
+    static constexpr int numNotes = 128;
+
+    static constexpr float dbMin        = -120.0f;
+    static constexpr float dbMax        = 24.0f;
+    static constexpr int   dbStepsPerDb = 4;
+    static constexpr int   dbSize       = static_cast<int>(dbMax - dbMin) * dbStepsPerDb;   // 576 steps
+
+    static constexpr int exp2Size = 256;
+
+    static constexpr int velocitySteps = 128;                 // 7-bit MIDI velocity
+    static constexpr int keyTrackRootNote = 60;               // key tracking pivots on middle C
+
+    static constexpr int wtBits      = 11;
+    static constexpr int wtSize      = 1 << wtBits;           // 2048
+    static constexpr int wtMips      = wtBits;                // 1024 … 1 harmonics
+    static constexpr int wtGuardPre  = 1;
+    static constexpr int wtGuardPost = 2;
+    static constexpr int wtRowStride = (wtSize + wtGuardPre + wtGuardPost + 15) & ~15;   // 64-byte rows
+    static constexpr int wtShapes    = 4;
+
+    static constexpr size_t alignment = 64;
+
+    // ------------------------------------------------------------
+    // Registry
+    // ------------------------------------------------------------
+    static const DspTables& get()
+    {
+        static const DspTables instance(cacheFileSetting());
+        return instance;
+    }
+
+    // Must be called before the first get(); later calls have no effect
+    // on the shared instance.
+    static void setCacheFile(const juce::File& file)
+    {
+        std::lock_guard<std::mutex> lock(cacheFileMutex());
+        cacheFileStorage() = file;
+    }
+
+    static juce::File defaultCacheFile()
+    {
+        return juce::File::getSpecialLocation(juce::File::tempDirectory)
+                   .getChildFile("MIDIControl001-dsp-tables.bin");
+    }
+
+    // Standalone instance (tests / benchmarks); the plugin uses get().
+    explicit DspTables(const juce::File& cacheFile = juce::File())
+    {
+        if (cacheFile != juce::File() && mapCache(cacheFile))
+            return;
+
+        heap_.assign(payloadFloats + alignment / sizeof(float), 0.0f);
+        void*  p     = heap_.data();
+        size_t space = heap_.size() * sizeof(float);
+        auto*  blob  = static_cast<float*>(std::align(alignment, payloadFloats * sizeof(float), p, space));
+
+        build(blob);
+        base_ = blob;
+
+        if (cacheFile != juce::File())
+            writeCache(cacheFile);
+    }
+
+    DspTables(const DspTables&) = delete;
+    DspTables& operator=(const DspTables&) = delete;
+
+    bool wasLoadedFromCache() const noexcept { return mapped_ != nullptr; }
+
+    // ------------------------------------------------------------
+    // Tables
+    // ------------------------------------------------------------
+    const float* sine() const noexcept { return base_ + sineOffset; }
+
+    float noteToHz(int note) const noexcept
+    {
+        return base_[noteOffset + static_cast<size_t>(std::clamp(note, 0, numNotes - 1))];
+    }
+
+    // Linear interpolation; clamps to [dbMin, dbMax], 0 at dbMin.
+    float dbToGain(float db) const noexcept
+    {
+        const float x = (std::clamp(db, dbMin, dbMax) - dbMin) * static_cast<float>(dbStepsPerDb);
+        const int   i = std::min(static_cast<int>(x), dbSize - 1);
+        const float f = x - static_cast<float>(i);
+
+        const float* t = base_ + dbOffset;
+        return t[i] + (t[i + 1] - t[i]) * f;
+    }
+
+    // 2^x for any x: table on the fractional part, exponent via ldexp.
+    float exp2(float x) const noexcept
+    {
+        const float fl = std::floor(x);
+        const float y  = (x - fl) * static_cast<float>(exp2Size);
+        const int   i  = std::min(static_cast<int>(y), exp2Size - 1);
+        const float f  = y - static_cast<float>(i);
+
+        const float* t = base_ + exp2Offset;
+        return std::ldexp(t[i] + (t[i + 1] - t[i]) * f, static_cast<int>(fl));
+    }
+
+    // Velocity (0 … 1) → gain for a curve, at 7-bit resolution.
+    float velocityGain(VelocityCurve curve, float velocity) const noexcept
+    {
+        const int c = std::clamp(static_cast<int>(curve), 0, numVelocityCurves - 1);
+        const int v = static_cast<int>(std::clamp(velocity, 0.0f, 1.0f) * (velocitySteps - 1) + 0.5f);
+        return base_[velOffset + static_cast<size_t>(c * velocitySteps + v)];
+    }
+
+    // Per-note gain coefficient: velocity curve × key tracking
+    // (dbPerOctave around keyTrackRootNote). Two table reads, meant
+    // to be evaluated once at noteOn.
+    float noteGain(VelocityCurve curve, float velocity, int note, float dbPerOctave) const noexcept
+    {
+        const float octaves = static_cast<float>(note - keyTrackRootNote) / 12.0f;
+        const float keyGain = (dbPerOctave == 0.0f) ? 1.0f : dbToGain(dbPerOctave * octaves);
+        return velocityGain(curve, velocity) * keyGain;
+    }
+
+    // Mip row for a shape, offset past the leading guard point.
+    const float* wavetableRow(OscType shape, int mip) const noexcept
+    {
+        const int s = std::clamp(static_cast<int>(shape), 0, wtShapes - 1);
+        const int m = std::clamp(mip, 0, wtMips - 1);
+        return base_ + wtOffset + static_cast<size_t>((s * wtMips + m) * wtRowStride + wtGuardPre);
+    }
+
+private:
+    // ------------------------------------------------------------
+    // Blob layout (offsets in floats, each a multiple of 16 = 64 B)
+    // ------------------------------------------------------------
+    template <size_t Floats>
+    static constexpr size_t padded = (Floats + 15) & ~size_t(15);
+
+    static constexpr size_t sineOffset    = 0;
+    static constexpr size_t noteOffset    = sineOffset + padded<sineSize + 1>;
+    static constexpr size_t dbOffset      = noteOffset + padded<numNotes>;
+    static constexpr size_t exp2Offset    = dbOffset   + padded<dbSize + 1>;
+    static constexpr size_t velOffset     = exp2Offset + padded<exp2Size + 1>;
+    static constexpr size_t wtOffset      = velOffset  + padded<static_cast<size_t>(numVelocityCurves * velocitySteps)>;
+    static constexpr size_t payloadFloats = wtOffset   + padded<static_cast<size_t>(wtShapes * wtMips * wtRowStride)>;
+
+    // ------------------------------------------------------------
+    // Cache file header (64 bytes, so the payload stays aligned)
+    // ------------------------------------------------------------
+    static constexpr uint32_t cacheMagic   = 0x5444434Du;   // "MCDT"
+    static constexpr uint32_t cacheVersion = 2u;   // 2: velocity curves
+
+    struct CacheHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t layout[8];
+        uint64_t payloadBytes;
+        uint64_t checksum;
+        uint32_t reserved[2];
+    };
+    static_assert(sizeof(CacheHeader) == alignment, "cache header must keep the payload 64-byte aligned");
+
+    static CacheHeader makeHeader(const float* payload) noexcept
+    {
+        CacheHeader h {};
+        h.magic        = cacheMagic;
+        h.version      = cacheVersion;
+        h.layout[0]    = sineSize;
+        h.layout[1]    = numNotes;
+        h.layout[2]    = dbSize;
+        h.layout[3]    = exp2Size;
+        h.layout[4]    = wtSize;
+        h.layout[5]    = wtMips;
+        h.layout[6]    = wtRowStride;
+        h.layout[7]    = wtShapes;
+        h.payloadBytes = payloadFloats * sizeof(float);
+        h.checksum     = checksum(payload);
+        return h;
+    }
+
+    // FNV-1a over 64-bit words.
+    static uint64_t checksum(const float* payload) noexcept
+    {
+        const auto* w = reinterpret_cast<const uint64_t*>(payload);
+        uint64_t h = 1469598103934665603ull;
+        for (size_t i = 0; i < payloadFloats / 2; ++i)
+        {
+            h ^= w[i];
+            h *= 1099511628211ull;
+        }
+        return h;
+    }
+
+    bool mapCache(const juce::File& file)
+    {
+        if (!file.existsAsFile())
+            return false;
+
+        auto mapped = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+        const auto* data = static_cast<const char*>(mapped->getData());
+
+        if (data == nullptr || mapped->getSize() != sizeof(CacheHeader) + payloadFloats * sizeof(float))
+            return false;
+
+        CacheHeader stored;
+        std::memcpy(&stored, data, sizeof(CacheHeader));
+
+        const auto* payload  = reinterpret_cast<const float*>(data + sizeof(CacheHeader));
+        const auto  expected = makeHeader(payload);
+
+        if (std::memcmp(&stored, &expected, sizeof(CacheHeader)) != 0)
+        {
+            DBG("DspTables: stale cache " << file.getFullPathName() << ", rebuilding");
+            return false;
+        }
+
+        base_   = payload;
+        mapped_ = std::move(mapped);
+        return true;
+    }
+
+    void writeCache(const juce::File& file) const
+    {
+        file.getParentDirectory().createDirectory();
+
+        juce::TemporaryFile temp(file);
+        {
+            juce::FileOutputStream out(temp.getFile());
+            if (!out.openedOk())
+                return;
+
+            const auto header = makeHeader(base_);
+            out.write(&header, sizeof(header));
+            out.write(base_, payloadFloats * sizeof(float));
+            out.flush();
+        }
+
+        if (!temp.overwriteTargetFileWithTemporary())
+            DBG("DspTables: could not write cache " << file.getFullPathName());
+    }
+
+    // ------------------------------------------------------------
+    // Table generation
+    // ------------------------------------------------------------
+    static void build(float* t)
+    {
+        constexpr double twoPi = 6.283185307179586476925286766559;
+
+        for (int i = 0; i <= sineSize; ++i)
+            t[sineOffset + static_cast<size_t>(i)] =
+                static_cast<float>(std::sin(twoPi * static_cast<double>(i) / static_cast<double>(sineSize)));
+
+        // Same float expression the voices used, so pitches are unchanged.
+        for (int n = 0; n < numNotes; ++n)
+            t[noteOffset + static_cast<size_t>(n)] = 440.0f * std::pow(2.0f, (n - 69) / 12.0f);
+
+        t[dbOffset] = 0.0f;
+        for (int i = 1; i <= dbSize; ++i)
+        {
+            const double db = static_cast<double>(dbMin) + static_cast<double>(i) / dbStepsPerDb;
+            t[dbOffset + static_cast<size_t>(i)] = static_cast<float>(std::pow(10.0, db / 20.0));
+        }
+
+        for (int i = 0; i <= exp2Size; ++i)
+            t[exp2Offset + static_cast<size_t>(i)] =
+                static_cast<float>(std::exp2(static_cast<double>(i) / exp2Size));
+
+        for (int c = 0; c < numVelocityCurves; ++c)
+            for (int v = 0; v < velocitySteps; ++v)
+                t[velOffset + static_cast<size_t>(c * velocitySteps + v)] =
+                    velocityCurveValue(static_cast<VelocityCurve>(c), static_cast<double>(v) / (velocitySteps - 1));
+
+        for (int s = 0; s < wtShapes; ++s)
+            buildWavetable(static_cast<OscType>(s), t + wtOffset + static_cast<size_t>(s * wtMips * wtRowStride));
+    }
+
+    static float velocityCurveValue(VelocityCurve curve, double v) noexcept
+    {
+        switch (curve)
+        {
+            case VelocityCurve::Soft:  return static_cast<float>(std::sqrt(v));
+            case VelocityCurve::Hard:  return static_cast<float>(v * v);
+            case VelocityCurve::Fixed: return 1.0f;
+            case VelocityCurve::Linear:
+            default:                   return static_cast<float>(v);
+        }
+    }
+
+    // Fourier amplitude of harmonic h (sine series) for each shape.
+    static double harmonicAmplitude(OscType shape, int h) noexcept
+    {
+        constexpr double pi = 3.14159265358979323846;
+
+        switch (shape)
+        {
+            case OscType::Saw:
+                return ((h % 2) ? 2.0 : -2.0) / (pi * h);
+
+            case OscType::Square:
+                return (h % 2) ? 4.0 / (pi * h) : 0.0;
+
+            case OscType::Triangle:
+                if ((h % 2) == 0) return 0.0;
+                return (((h / 2) % 2) ? -8.0 : 8.0) / (pi * pi * h * h);
+
+            case OscType::Sine:
+            default:
+                return (h == 1) ? 1.0 : 0.0;
+        }
+    }
+
+    // Mip m holds harmonics 1 … (wtSize/2) >> m, every mip scaled by
+    // mip 0's peak so levels match across octaves. Guard points: one
+    // before and two after each row, so cubic reads never wrap.
+    static void buildWavetable(OscType shape, float* rows)
+    {
+        constexpr double twoPi = 6.283185307179586476925286766559;
+
+        // sin(2π·k/N) for integer k: harmonic h at sample i is
+        // sinTab[(h·i) mod N], so no trig in the inner loop.
+        std::vector<double> sinTab(static_cast<size_t>(wtSize));
+        for (int k = 0; k < wtSize; ++k)
+            sinTab[static_cast<size_t>(k)] = std::sin(twoPi * k / wtSize);
+
+        std::vector<double> acc(static_cast<size_t>(wtSize));
+        double normalise = 1.0;
+
+        for (int m = 0; m < wtMips; ++m)
+        {
+            std::fill(acc.begin(), acc.end(), 0.0);
+
+            for (int h = 1; h <= (wtSize / 2) >> m; ++h)
+            {
+                const double a = harmonicAmplitude(shape, h);
+                if (a == 0.0)
+                    continue;
+
+                for (int i = 0; i < wtSize; ++i)
+                    acc[static_cast<size_t>(i)] += a * sinTab[static_cast<size_t>((h * i) & (wtSize - 1))];
+            }
+
+            if (m == 0)
+            {
+                double peak = 0.0;
+                for (double v : acc)
+                    peak = std::max(peak, std::abs(v));
+                normalise = (peak > 0.0) ? 1.0 / peak : 1.0;
+            }
+
+            float* r = rows + static_cast<size_t>(m * wtRowStride);
+            for (int i = 0; i < wtSize; ++i)
+                r[wtGuardPre + i] = static_cast<float>(acc[static_cast<size_t>(i)] * normalise);
+
+            r[0]                       = r[wtSize];           // x[−1]
+            r[wtGuardPre + wtSize]     = r[wtGuardPre];       // x[N]
+            r[wtGuardPre + wtSize + 1] = r[wtGuardPre + 1];   // x[N+1]
+        }
+    }
+
+    // ------------------------------------------------------------
+    // Cache file setting (read once, by the first get())
+    // ------------------------------------------------------------
+    static std::mutex& cacheFileMutex()
+    {
+        static std::mutex m;
+        return m;
+    }
+
+    static juce::File& cacheFileStorage()
+    {
+        static juce::File f;
+        return f;
+    }
+
+    static juce::File cacheFileSetting()
+    {
+        std::lock_guard<std::mutex> lock(cacheFileMutex());
+        return cacheFileStorage();
+    }
+
+    const float* base_ = nullptr;
+    std::vector<float> heap_;
+    std::unique_ptr<juce::MemoryMappedFile> mapped_;
+};
@@ -0,0 +1,138 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cmath>
+#include <algorithm>
+
+// ============================================================
+// HalfBandDecimator — polyphase 2:1 half-band FIR decimator
+// ------------------------------------------------------------
+// Design goals:
+//  • Fixed-size, preallocated state (no allocations, no locks)
+//  • Polyphase form: only the non-zero taps are evaluated, and
+//    each tap is one vectorised multiply-add over the whole block
+//    (juce::FloatVectorOperations → SSE/NEON)
+//  • Linear phase; group delay is exposed so callers can align
+//
+// Filter: Kaiser-windowed half-band, numTaps = 4·numPairs − 1.
+// Every even offset from the centre tap is zero, so
+//
+//   y[m] = ½·o[m−K] + Σ_j c_j · (e[m−K+1+j] + e[m−K−j])
+//
+// with e[k] = x[2k], o[k] = x[2k+1], K = numPairs.
+//
+// Typical usage:
+//   dec.reset();
+//   dec.process(in2x, out1x, numOut);  // in2x holds 2·numOut samples
+// ============================================================
+
+class HalfBandDecimator {
+public:
+    static constexpr int numPairs = 12;                 // K
+    static constexpr int numTaps  = 4 * numPairs - 1;   // 47
+    static constexpr int maxBlock = 128;                // outputs per process() call
+
+    // Group delay, in input-rate samples.
+    static constexpr int groupDelayInputSamples = 2 * numPairs - 1;
+
+    HalfBandDecimator() { reset(); }
+
+    void reset() noexcept
+    {
+        even_.fill(0.0f);
+        odd_.fill(0.0f);
+    }
+
+    // in: 2·numOut input samples; out: numOut samples. numOut ≤ maxBlock.
+    void process(const float* in, float* out, int numOut) noexcept
+    {
+        numOut = std::min(numOut, maxBlock);
+        if (numOut <= 0)
+            return;
+
+        float* e = even_.data();
+        float* o = odd_.data();
+
+        // Deinterleave into the polyphase tails.
+        for (int m = 0; m < numOut; ++m)
+        {
+            e[evenHistory + m] = in[2 * m];
+            o[oddHistory  + m] = in[2 * m + 1];
+        }
+
+        // Centre tap (odd phase), then one vector MAC per tap pair.
+        const auto& c = coefficients();
+        juce::FloatVectorOperations::copyWithMultiply(out, o, 0.5f, numOut);
+
+        for (int j = 0; j < numPairs; ++j)
+        {
+            juce::FloatVectorOperations::addWithMultiply(out, e + evenHistory - numPairs + 1 + j, c[static_cast<size_t>(j)], numOut);
+            juce::FloatVectorOperations::addWithMultiply(out, e + evenHistory - numPairs - j,     c[static_cast<size_t>(j)], numOut);
+        }
+
+        // Keep the newest history samples for the next call.
+        std::copy(e + numOut, e + numOut + evenHistory, e);
+        std::copy(o + numOut, o + numOut + oddHistory,  o);
+    }
+
+    // Side-tap coefficients c_j (shared, computed once).
+    static const std::array<float, numPairs>& coefficients()
+    {
+        static const std::array<float, numPairs> c = designCoefficients();
+        return c;
+    }
+
+private:
+    static constexpr int evenHistory = 2 * numPairs - 1;
+    static constexpr int oddHistory  = numPairs;
+
+    static constexpr double kaiserBeta = 7.0;   // ≈ −70 dB stopband
+
+    // Zeroth-order modified Bessel function (power series).
+    static double besselI0(double x) noexcept
+    {
+        double sum = 1.0, term = 1.0;
+        const double q = 0.25 * x * x;
+        for (int k = 1; k < 32; ++k)
+        {
+            term *= q / (static_cast<double>(k) * static_cast<double>(k));
+            sum  += term;
+        }
+        return sum;
+    }
+
+    // h[C ± d] = sin(πd/2)/(πd) · w(d) for odd d = 2j+1,
+    // then normalised so the DC gain is exactly 1.
+    static std::array<float, numPairs> designCoefficients() noexcept
+    {
+        constexpr double pi = 3.14159265358979323846;
+        const double halfLen = static_cast<double>(2 * numPairs);   // C + 1
+        const double i0Beta  = besselI0(kaiserBeta);
+
+        std::array<double, numPairs> h {};
+        double sideSum = 0.0;
+
+        for (int j = 0; j < numPairs; ++j)
+        {
+            const double d      = static_cast<double>(2 * j + 1);
+            const double ratio  = d / halfLen;
+            const double window = besselI0(kaiserBeta * std::sqrt(1.0 - ratio * ratio)) / i0Beta;
+            const double sign   = (j % 2 == 0) ? 1.0 : -1.0;
+
+            h[static_cast<size_t>(j)] = sign / (pi * d) * window;
+            sideSum += 2.0 * h[static_cast<size_t>(j)];
+        }
+
+        // Centre tap is 0.5: scale the side taps so 0.5 + Σ = 1.
+        const double scale = 0.5 / sideSum;
+
+        std::array<float, numPairs> c {};
+        for (int j = 0; j < numPairs; ++j)
+            c[static_cast<size_t>(j)] = static_cast<float>(h[static_cast<size_t>(j)] * scale);
+
+        return c;
+    }
+
+    std::array<float, evenHistory + maxBlock> even_ {};
+    std::array<float, oddHistory  + maxBlock> odd_  {};
+};
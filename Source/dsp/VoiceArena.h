@@ -0,0 +1,95 @@
+#pragma once
+#include "dsp/BaseVoice.h"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+// ============================================================
+// VoiceArena — one cache-aligned block holding a voice pool
+// ------------------------------------------------------------
+// VoiceManager reserves the arena once (message thread, prepare)
+// for the largest pool any mode needs. Voices are then placement-
+// constructed back to back, each slot rounded up to whole 64-byte
+// lines, so iterating the pool walks memory sequentially and no
+// two voices share a cache line.
+//
+// clear() destroys the voices and rewinds; the storage itself is
+// kept, so mode switches never touch the global allocator.
+// ============================================================
+
+class VoiceArena {
+public:
+    static constexpr size_t alignment = 64;
+    static constexpr int    maxSlots  = 64;
+
+    // Bytes one voice of type Voice occupies in the arena.
+    template <typename Voice>
+    static constexpr size_t slotBytes() noexcept
+    {
+        static_assert(alignof(Voice) <= alignment, "voice alignment exceeds the arena line size");
+        return (sizeof(Voice) + alignment - 1) & ~(alignment - 1);
+    }
+
+    VoiceArena() = default;
+    ~VoiceArena() { clear(); }
+
+    VoiceArena(const VoiceArena&) = delete;
+    VoiceArena& operator=(const VoiceArena&) = delete;
+
+    // Grows (never shrinks) the storage. Destroys any live voices.
+    void reserve(size_t bytes)
+    {
+        clear();
+
+        const size_t lines = (bytes + alignment - 1) / alignment;
+        if (lines <= capacityLines_)
+            return;
+
+        storage_.reset(new Line[lines]);
+        capacityLines_ = lines;
+    }
+
+    // nullptr when the arena is full (caller falls back or drops the voice).
+    template <typename Voice>
+    Voice* construct()
+    {
+        constexpr size_t lines = slotBytes<Voice>() / alignment;
+
+        if (usedLines_ + lines > capacityLines_ || numLive_ >= maxSlots)
+            return nullptr;
+
+        auto* v = new (static_cast<void*>(storage_.get() + usedLines_)) Voice();
+        usedLines_ += lines;
+        live_[static_cast<size_t>(numLive_++)] = v;
+        return v;
+    }
+
+    // Destroys in reverse construction order and rewinds.
+    void clear() noexcept
+    {
+        while (numLive_ > 0)
+            live_[static_cast<size_t>(--numLive_)]->~BaseVoice();
+
+        usedLines_ = 0;
+    }
+
+    size_t capacityBytes() const noexcept { return capacityLines_ * alignment; }
+    size_t usedBytes() const noexcept     { return usedLines_ * alignment; }
+    int    size() const noexcept          { return numLive_; }
+
+private:
+    struct alignas(alignment) Line
+    {
+        unsigned char bytes[alignment];
+    };
+
+    std::unique_ptr<Line[]> storage_;
+    size_t capacityLines_ = 0;
+    size_t usedLines_     = 0;
+
+    std::array<BaseVoice*, maxSlots> live_ {};
+    int numLive_ = 0;
+};
@@ -0,0 +1,77 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "dsp/BaseVoice.h"
+#include "dsp/DspTables.h"
+
+// ============================================================
+// VoiceExpression — smoothed per-note bend / pressure / timbre
+// ------------------------------------------------------------
+// Targets arrive from VoiceManager's MPE dispatcher (one voice per
+// member channel); the voice advances the smoothers a chunk at a
+// time and re-derives pitch/gain only while they move, so a note
+// without expression changes costs nothing per sample.
+// ============================================================
+
+class VoiceExpression {
+public:
+    static constexpr double smoothingSeconds = 0.01;   // 10 ms glide, no zipper noise
+
+    void prepare(double sampleRate)
+    {
+        bend_.reset(sampleRate, smoothingSeconds);
+        pressure_.reset(sampleRate, smoothingSeconds);
+        timbre_.reset(sampleRate, smoothingSeconds);
+        set(NoteExpression {}, true);
+    }
+
+    void set(const NoteExpression& e, bool immediate)
+    {
+        if (immediate)
+        {
+            bend_.setCurrentAndTargetValue(e.bendSemis);
+            pressure_.setCurrentAndTargetValue(e.pressure);
+            timbre_.setCurrentAndTargetValue(e.timbre);
+        }
+        else
+        {
+            bend_.setTargetValue(e.bendSemis);
+            pressure_.setTargetValue(e.pressure);
+            timbre_.setTargetValue(e.timbre);
+        }
+        changed_ = true;
+    }
+
+    bool isSmoothing() const noexcept
+    {
+        return bend_.isSmoothing() || pressure_.isSmoothing() || timbre_.isSmoothing();
+    }
+
+    // True once after set() or while smoothing: the voice should
+    // re-derive its pitch / gain for the next chunk.
+    bool needsUpdate() const noexcept { return changed_ || isSmoothing(); }
+
+    // Moves the smoothers n samples on and clears the change flag.
+    void advance(int n) noexcept
+    {
+        bend_.skip(n);
+        pressure_.skip(n);
+        timbre_.skip(n);
+        changed_ = false;
+    }
+
+    float bendSemis() const noexcept { return bend_.getCurrentValue(); }
+    float pressure()  const noexcept { return pressure_.getCurrentValue(); }
+    float timbre()    const noexcept { return timbre_.getCurrentValue(); }
+
+    float pitchRatio() const noexcept
+    {
+        const float semis = bendSemis();
+        return semis == 0.0f ? 1.0f : DspTables::get().exp2(semis / 12.0f);
+    }
+
+private:
+    juce::SmoothedValue<float> bend_     { 0.0f };
+    juce::SmoothedValue<float> pressure_ { 0.0f };
+    juce::SmoothedValue<float> timbre_   { 0.5f };
+    bool changed_ = false;
+};
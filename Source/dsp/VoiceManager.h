@@ -1,17 +1,22 @@
 #pragma once
 #include <juce_core/juce_core.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
 #include <vector>
 #include <memory>
 #include <algorithm>
-#include <fstream>
 #include <numeric>   // for inner_product
 #include <cmath>     // for std::exp, std::log
 #include <functional>
+#include <thread>
+#include <type_traits>
 
 #include "params/ParameterSnapshot.h"
-#include "dsp/voices/VoiceA.h"
-#include "dsp/voices/VoiceDopp.h"
 #include "dsp/BaseVoice.h"
+#include "dsp/ControllerRouting.h"
+#include "dsp/VoiceArena.h"
+#include "dsp/VoiceRegistry.h"
+#include "dsp/VoiceRenderPool.h"
 #include "params/ParamLayout.h"
 
 // ============================================================
@@ -20,40 +25,43 @@
 
 class VoiceManager {
 public:
+    // Snapshot source, called on the audio thread at startBlock().
+    // If empty, startBlock() uses a default ParameterSnapshot.
     using SnapshotMaker = std::function<ParameterSnapshot(void)>; // callback type
 
     // Optional injection point for mode-aware voice construction.
     // If empty, we fall back to makeVoiceForMode(mode_).
     using VoiceFactory  = std::function<std::unique_ptr<BaseVoice>(VoiceMode)>;
 
-    explicit VoiceManager(SnapshotMaker makeSnapshot,
+    explicit VoiceManager(SnapshotMaker makeSnapshot = {},
                           VoiceFactory voiceFactory = {})
         : makeSnapshot_(std::move(makeSnapshot)),
           voiceFactory_(std::move(voiceFactory))
     {}
 
-    static constexpr int maxVoices = 32;
+    static constexpr int maxVoices = maxPoolVoices;
+    static_assert(maxVoices <= VoiceRenderPool::maxTasks, "one render task per voice");
 
     // ============================================================
-    // Phase III — Mode-aware voice factory (currently inert)
+    // Phase III — Mode-aware voice factory
     // ============================================================
-    std::unique_ptr<BaseVoice> makeVoiceForMode(VoiceMode mode) const
+    // Per-mode pool size and arena bytes come from VoiceRegistry
+    // (band-bank voices are capped by their measured per-voice cost,
+    // see VoiceEns::polyphonyLimit).
+    static constexpr int polyphonyForMode(VoiceMode mode) noexcept
     {
-        // Phase III scaffolding:
-        // All modes currently instantiate VoiceA to keep DSP identical.
-        switch (mode)
-        {
-            case VoiceMode::VoiceA:
-                return std::make_unique<VoiceA>();
+        return VoiceRegistry::maxPolyphony(mode);
+    }
 
-            case VoiceMode::VoiceDopp:
-                return std::make_unique<VoiceDopp>();
+    // Sized for the largest mode so mode switches reuse the arena.
+    static constexpr size_t arenaBytesNeeded() noexcept
+    {
+        return VoiceRegistry::maxArenaBytes();
+    }
 
-            case VoiceMode::VoiceLET:
-            case VoiceMode::VoiceFM:
-            default:
-                return std::make_unique<VoiceA>();
-        }
+    std::unique_ptr<BaseVoice> makeVoiceForMode(VoiceMode mode) const
+    {
+        return VoiceRegistry::makeVoice(mode);
     }
 
     // Central hook for future mode-specific per-block behavior.
@@ -65,8 +73,10 @@ public:
             case VoiceMode::VoiceDopp:
             case VoiceMode::VoiceLET:
             case VoiceMode::VoiceFM:
+            case VoiceMode::VoiceEns:
             default:
-                // Current plugin: only VoiceA exists, nothing to do yet.
+                // No mode needs per-block configuration; construction
+                // and dispatch come from VoiceRegistry.
                 break;
         }
     }
@@ -89,18 +99,19 @@ public:
                 break;
 
             case VoiceMode::VoiceDopp:
-                // Future: Doppler block graph routing
-                // For now: identical behavior to VoiceA
+                // Doppler field is rendered per voice (VoiceDopp)
                 break;
 
             case VoiceMode::VoiceLET:
-                // Future: LET time-warping graph
-                // For now: identical behavior to VoiceA
+                // Relativistic field is rendered per voice (VoiceLET)
                 break;
 
             case VoiceMode::VoiceFM:
-                // Future: FM operator graph dispatch
-                // For now: identical behavior to VoiceA
+                // Operator graph is rendered per voice (VoiceFM)
+                break;
+
+            case VoiceMode::VoiceEns:
+                // Band bank is self-contained per voice
                 break;
 
             default:
@@ -140,28 +151,144 @@ public:
     void setVoiceFactory(VoiceFactory factory)
     {
         voiceFactory_ = std::move(factory);
-        rebuildVoicesForMode();
+        invalidateVoices();
     }
 
-    void prepare(double sampleRate)
+    // ============================================================
+    // Parallel voice rendering configuration (message thread only)
+    // ------------------------------------------------------------
+    // numThreads includes the audio thread itself; 1 = serial.
+    // Only recorded here: the pool is (re)started by the next
+    // prepare(), which the host never runs concurrently with
+    // render(), so workers are never replaced mid-job.
+    // ============================================================
+    void setNumRenderThreads(int numThreads)
+    {
+        numRenderThreads_ = std::clamp(numThreads, 1, VoiceRenderPool::maxWorkers + 1);
+    }
+
+    // Requested count; getLastRenderMetrics().threads is the live one.
+    int getNumRenderThreads() const noexcept { return numRenderThreads_; }
+
+    // Minimum number of active voices before the pool is used.
+    void setParallelThreshold(int minActiveVoices) noexcept
+    {
+        parallelThreshold_ = std::max(1, minActiveVoices);
+    }
+
+    int getParallelThreshold() const noexcept { return parallelThreshold_; }
+
+    // Per-block render scheduling diagnostics (last render() call).
+    struct RenderMetrics
+    {
+        int    activeVoices    = 0;
+        int    samplesRendered = 0;    // voice-samples actually computed (tails stop early)
+        bool   parallel        = false;
+        int    threads         = 1;
+        int    steals          = 0;
+        double imbalance       = 1.0;  // busiest thread / mean thread busy time
+        double makespanUs      = 0.0;
+    };
+
+    const RenderMetrics& getLastRenderMetrics() const noexcept { return renderMetrics_; }
+
+    // Rendering is serial unless a caller opts in: a pool per instance
+    // would put up to three spinning workers behind every plugin in a
+    // session. The processor opts in through its "Render Threads"
+    // parameter; this is a sensible value to opt in with.
+    static int suggestedNumRenderThreads() noexcept
+    {
+        const int hw = static_cast<int>(std::thread::hardware_concurrency());
+        return juce::jlimit(1, 4, hw / 2);
+    }
+
+    void prepare(double sampleRate, int maxBlockSize = 0)
     {
         sampleRate_ = sampleRate;
         globalGain_.reset(sampleRate, 0.005); // 5 ms fade on poly changes
+        agcSumSq_   = 0.0f;
+        agcSamples_ = 0;
+
+        // Per-voice scratch rows for the parallel path (one row per voice
+        // slot). Blocks larger than this fall back to serial rendering.
+        if (maxBlockSize > scratchCapacity_)
+        {
+            scratchCapacity_ = maxBlockSize;
+            voiceScratch_.assign(static_cast<size_t>(maxVoices) * static_cast<size_t>(scratchCapacity_), 0.0f);
+        }
+
+        renderPool_.start(numRenderThreads_ - 1);
 
         // Phase III B7 — ensure lastMode_ is in sync at startup.
         lastMode_ = mode_;
 
-        // Phase III B6 — centralize voice allocation in a helper.
+        // Voices are built by prepareVoices() or, failing that, the
+        // first note. Their storage is reserved here, once, so building
+        // them (on any mode) needs no allocation.
+        invalidateVoices();
+        voices_.reserve(maxVoices);
+        if (arena_.capacityBytes() < arenaBytesNeeded())
+            arena_.reserve(arenaBytesNeeded());
+
+        DBG("VoiceManager prepared at " + juce::String(sampleRate)
+            + " (voices deferred)");
+    }
+
+    // ============================================================
+    // Lazy voice pool
+    // ------------------------------------------------------------
+    // prepare() and mode changes only mark the pool stale. Callers
+    // build it eagerly with prepareVoices() from a non-realtime
+    // thread (the processor does so in prepareToPlay); otherwise
+    // the first handleNoteOn() builds it.
+    // ============================================================
+    void prepareVoices()
+    {
+        if (voicesReady_)
+            return;
+
         rebuildVoicesForMode();
+        voicesReady_ = true;
+
+        // Voice controls that arrived while the pool was empty.
+        for (int t = 0; t < numCcTargets; ++t)
+        {
+            const int control = voiceControlFor(static_cast<CcTarget>(t));
+            const float value = lastControlValue_[static_cast<size_t>(t)];
+            if (control >= 0 && value >= 0.0f)
+                for (auto& v : voices_)
+                    v->handleController(control, value);
+        }
 
-        DBG("VoiceManager prepared " + juce::String(voices_.size()) +
-            " voices at " + juce::String(sampleRate));
+        voiceCcEpoch_.fill(ccEpochNow_);
+
+        if (currentSnapshot_ != nullptr)
+            applyVoiceParams(*currentSnapshot_);
     }
 
+    bool areVoicesPrepared() const noexcept { return voicesReady_; }
+    int  getNumConstructedVoices() const noexcept { return static_cast<int>(voices_.size()); }
+
+    // Snapshot of the current block (after CC re-application), or
+    // nullptr before the first startBlock(). Audio thread.
+    const ParameterSnapshot* getCurrentSnapshot() const noexcept { return currentSnapshot_; }
+
     void startBlock()
     {
-        static ParameterSnapshot snapshot;
-        snapshot = makeSnapshot_();
+        startBlock(makeSnapshot_ ? makeSnapshot_() : ParameterSnapshot{});
+    }
+
+    // Same, with a snapshot the caller has already built (the
+    // processor builds one per sub-block for its own mix and gain).
+    void startBlock(const ParameterSnapshot& source)
+    {
+        // Per-instance: the voices and currentSnapshot_ read this
+        // until the next startBlock().
+        auto& snapshot = blockSnapshot_;
+        snapshot = source;
+
+        // Controller map edits (MIDI learn, state restore) land here.
+        ccMap_ = &ccMaps_.acquire();
 
         // ============================================================
         // Phase III B9 — mode-aware routing hook (NEW, currently inert)
@@ -187,39 +314,56 @@ public:
         snapshot.envAttack  = ccCache.envAttack;
         snapshot.envRelease = ccCache.envRelease;
         snapshot.oscFreq    = ccCache.oscFreq;
+        snapshot.relVelocity = ccCache.relVelocity;
 
         currentSnapshot_ = &snapshot;
 
-        // ============================================================
-        // Phase III – B3: reconcile global vs per-voice params
-        //
-        // Effective per-voice parameters are derived from snapshot.voices[i],
-        // but the *global* (possibly CC-modified) env/freq fields win.
-        //
-        // This keeps APVTS + snapshot semantics intact for tests, while
-        // ensuring that the actual DSP hears the CC-driven envelope/freq.
-        // ============================================================
-        for (int i = 0; i < static_cast<int>(voices_.size()) && i < NUM_VOICES; ++i)
+        applyVoiceParams(snapshot);
+    }
+
+    // ============================================================
+    // Phase III – B3: reconcile global vs per-voice params
+    //
+    // The "voices/voiceN/…" groups are layers: every slot of the pool
+    // belongs to one, round robin, and is started (noteOn) and kept
+    // (updateParams) on that group's values. Once a controller has
+    // driven env/freq, the global (CC-modified) value wins for that
+    // field on every voice, so the DSP hears the CC-driven
+    // envelope/freq.
+    // ============================================================
+    static constexpr int voiceGroupForSlot(int slot) noexcept { return slot % NUM_VOICES; }
+
+    VoiceParams resolveVoiceParams(const ParameterSnapshot& snapshot, int slot) const noexcept
+    {
+        VoiceParams vp = snapshot.voices[static_cast<size_t>(voiceGroupForSlot(slot))];
+
+        if (ccCache.oscFreqSet)    vp.oscFreq    = snapshot.oscFreq;
+        if (ccCache.envAttackSet)  vp.envAttack  = snapshot.envAttack;
+        if (ccCache.envReleaseSet) vp.envRelease = snapshot.envRelease;
+
+        return vp;
+    }
+
+    void applyVoiceParams(const ParameterSnapshot& snapshot)
+    {
+        forEachConcreteVoice(static_cast<int>(voices_.size()), [this, &snapshot](int i, auto& voice)
         {
-            // Start from whatever per-voice parameters the snapshot captured
-            VoiceParams vp = snapshot.voices[i];
-
-            // Override with global, CC-modified values
-            vp.oscFreq    = snapshot.oscFreq;
-            vp.envAttack  = snapshot.envAttack;
-            vp.envRelease = snapshot.envRelease;
-
-            if (auto* voiceA = dynamic_cast<VoiceA*>(voices_[i].get()))
-                voiceA->updateParams(vp);
-            else if (auto* voiceD = dynamic_cast<VoiceDopp*>(voices_[i].get()))
-                voiceD->updateParams(vp);
-        }
+            voice.updateParams(resolveVoiceParams(snapshot, i));
+        });
     }
 
-    void handleNoteOn(int midiNote, float velocity)
+    // `channel` is the MIDI channel (1 … 16); only MPE uses it.
+    void handleNoteOn(int midiNote, float velocity, int channel = 1)
     {
         if (!currentSnapshot_) return;
 
+        // CCs that arrived before this note apply to it.
+        flushControllers();
+
+        // No-op once prepareVoices() has run; only a mode switch since
+        // then leaves the build to this (audio-thread) call.
+        prepareVoices();
+
         auto it = std::find_if(voices_.begin(), voices_.end(),
                                [](const auto& v) { return !v->isActive(); });
 
@@ -231,22 +375,45 @@ public:
                                   });
         }
 
-        if (auto* vd = dynamic_cast<VoiceDopp*>(it->get()))
-            vd->setPitchFromMidi(true);
+        withConcreteVoice(**it, [](auto& voice)
+        {
+            using Voice = std::decay_t<decltype(voice)>;
+            if constexpr (std::is_base_of_v<VoiceDopp, Voice>)
+                voice.setPitchFromMidi(true);
+        });
+
+        const int idx = static_cast<int>(it - voices_.begin());
+        syncControllers(idx);
 
-        (*it)->noteOn(*currentSnapshot_, midiNote, velocity);
+        // The voice starts on its group's values, the same ones
+        // applyVoiceParams() keeps it on.
+        ParameterSnapshot noteSnapshot = *currentSnapshot_;
+        const VoiceParams vp = resolveVoiceParams(noteSnapshot, idx);
+        noteSnapshot.oscFreq    = vp.oscFreq;
+        noteSnapshot.envAttack  = vp.envAttack;
+        noteSnapshot.envRelease = vp.envRelease;
+
+        (*it)->noteOn(noteSnapshot, midiNote, velocity);
+
+        // MPE: the member channel now belongs to this voice, which
+        // starts from the channel's current bend/pressure/timbre.
+        assignChannel(idx, isMpeMemberChannel(channel) ? channel : 0);
+        pushExpression(idx, true);
 
         DBG("[VM] NoteOn midiNote=" << midiNote);
-        std::cout << "[VM] NoteOn midiNote=" << midiNote << std::endl;
 
         globalGain_.setTargetValue(1.0f);
     }
 
-    void handleNoteOff(int midiNote)
+    void handleNoteOff(int midiNote, int channel = 1)
     {
-        for (auto& v : voices_)
+        const bool matchChannel = isMpeMemberChannel(channel);
+
+        for (size_t i = 0; i < voices_.size(); ++i)
         {
-            if (v->isActive() && v->getNote() == midiNote)
+            auto* v = voices_[i];
+            if (v->isActive() && v->getNote() == midiNote
+                && (!matchChannel || voiceChannel_[i] == channel))
                 v->noteOff();
         }
 
@@ -257,78 +424,257 @@ public:
         }
     }
 
+    // ============================================================
+    // MPE dispatch (lower zone)
+    // ------------------------------------------------------------
+    // Master channel 1, member channels 2 … 1 + memberChannels.
+    // A member channel carries one note: its bend / pressure /
+    // timbre (CC74) go to the owning voice through channelVoice_,
+    // O(1) per event. Master-channel (and, with MPE off, every
+    // channel's) bend and pressure apply to all voices; master bend
+    // adds to member bend.
+    // ============================================================
+    static constexpr int   numMidiChannels    = 16;
+    static constexpr int   mpeMasterChannel   = 1;
+    static constexpr float mpeMemberBendRange = 48.0f;   // semitones, MPE default
+    static constexpr float masterBendRange    = 2.0f;
+
+    // 0 turns MPE off (classic omni behaviour).
+    void setMpeMemberChannels(int numMemberChannels) noexcept
+    {
+        mpeMemberChannels_ = std::clamp(numMemberChannels, 0, numMidiChannels - 1);
+    }
+
+    int  getMpeMemberChannels() const noexcept { return mpeMemberChannels_; }
+    bool isMpeEnabled() const noexcept         { return mpeMemberChannels_ > 0; }
+
+    bool isMpeMemberChannel(int channel) const noexcept
+    {
+        return mpeMemberChannels_ > 0
+            && channel > mpeMasterChannel
+            && channel <= mpeMasterChannel + mpeMemberChannels_;
+    }
+
+    // norm: −1 … +1 (14-bit wheel centred on 0)
+    void handlePitchBend(int channel, float norm)
+    {
+        if (isMpeMemberChannel(channel))
+        {
+            channelExpr(channel).bendSemis = norm * mpeMemberBendRange;
+            pushChannelExpression(channel);
+        }
+        else
+        {
+            masterExpr_.bendSemis = norm * masterBendRange;
+            pushExpressionToAll();
+        }
+    }
+
+    // pressure: 0 … 1
+    void handleChannelPressure(int channel, float pressure)
+    {
+        if (isMpeMemberChannel(channel))
+        {
+            channelExpr(channel).pressure = pressure;
+            pushChannelExpression(channel);
+        }
+        else
+        {
+            masterExpr_.pressure = pressure;
+            pushExpressionToAll();
+        }
+    }
+
+    // timbre: 0 … 1 (CC74)
+    void handleTimbre(int channel, float timbre)
+    {
+        if (isMpeMemberChannel(channel))
+        {
+            channelExpr(channel).timbre = timbre;
+            pushChannelExpression(channel);
+        }
+        else
+        {
+            masterExpr_.timbre = timbre;
+            pushExpressionToAll();
+        }
+    }
+
+    // Voice slot owning a member channel, or -1.
+    int getVoiceForChannel(int channel) const noexcept
+    {
+        if (channel < 1 || channel > numMidiChannels)
+            return -1;
+
+        const int idx = channelVoice_[static_cast<size_t>(channel)];
+        return (idx >= 0 && voiceChannel_[static_cast<size_t>(idx)] == channel) ? idx : -1;
+    }
+
     // ============================================================
     // Phase 5-C.4 — Persistent CC Cache + Dispatch
+    // ------------------------------------------------------------
+    // Messages are only recorded here (last value wins); the current
+    // ControllerMap is applied by flushControllers() before the next
+    // note event or render, and only active voices are called. A
+    // voice that starts later catches up from lastControlValue_.
     // ============================================================
     void handleController(int cc, float norm)
     {
-        std::ofstream log("voice_debug.txt", std::ios::app);
-        if (log.is_open())
-            log << "dispatch cc=" << cc << " norm=" << norm << std::endl;
+        if (!ControllerMap::isValidController(cc))
+            return;
 
-        std::cout << "[VoiceManager] dispatch cc=" << cc << " norm=" << norm << std::endl;
-        DBG("dispatch cc=" << cc << " norm=" << norm);
+        ++ccStats_.received;
+        ccQueue_.push(cc, norm);
+    }
+
+    void flushControllers()
+    {
+        if (!ccQueue_.hasPending())
+            return;
 
-        // Cache CC values for future snapshots
-        switch (cc)
+        ccQueue_.flush([this](int cc, float norm)
         {
-            case 3: // Attack: 1 ms → 2 s exponential
-                ccCache.envAttack = std::exp(juce::jmap(norm, std::log(0.001f), std::log(2.0f)));
-                break;
+            const auto& route = ccMap_->route(cc);
+            const float value = route.shape(norm);
 
-            case 4: // Release: 20 ms → 5 s logarithmic
-                ccCache.envRelease = std::exp(juce::jmap(norm, std::log(0.02f), std::log(5.0f)));
-                break;
+            // Cache CC values for future snapshots
+            switch (route.target)
+            {
+                case CcTarget::EnvAttack:
+                    ccCache.envAttack    = ControllerCurves::attackSeconds(value);
+                    ccCache.envAttackSet = true;
+                    break;
+                case CcTarget::EnvRelease:
+                    ccCache.envRelease    = ControllerCurves::releaseSeconds(value);
+                    ccCache.envReleaseSet = true;
+                    break;
+                case CcTarget::OscFreq:
+                    ccCache.oscFreq    = ControllerCurves::oscFreqHz(value);
+                    ccCache.oscFreqSet = true;
+                    break;
+                case CcTarget::VoiceControl6:
+                    ccCache.relVelocity = value;
+                    break;
+                default: break;
+            }
 
-            case 5: // Pitch sweep unchanged
-                ccCache.oscFreq = 440.0f + 2000.0f * (norm - 0.5f);
-                break;
+            ++ccStats_.applied;
+            DBG("dispatch cc=" << cc << " value=" << value);
 
-            default: break;
-        }
+            const int control = voiceControlFor(route.target);
+            if (control < 0)
+                return;
 
-        for (auto& v : voices_)
-            v->handleController(cc, norm);
+            // Remembered so a pool built later starts from the same state.
+            const auto t = static_cast<size_t>(route.target);
+            lastControlValue_[t] = value;
+            controlEpoch_[t]     = ++ccEpochNow_;
+
+            for (auto* v : voices_)
+            {
+                if (v->isActive())
+                {
+                    v->handleController(control, value);
+                    ++ccStats_.voiceCalls;
+                }
+            }
+        });
+
+        // Active voices have now seen every controller change.
+        for (size_t i = 0; i < voices_.size(); ++i)
+            if (voices_[i]->isActive())
+                voiceCcEpoch_[i] = ccEpochNow_;
     }
 
+    // Cumulative controller traffic (diagnostics / stress tests).
+    struct ControllerStats
+    {
+        uint64_t received   = 0;   // handleController() calls
+        uint64_t applied    = 0;   // after coalescing
+        uint64_t voiceCalls = 0;   // per-voice handleController() calls
+    };
+
+    const ControllerStats& getControllerStats() const noexcept { return ccStats_; }
+
+    // ============================================================
+    // Controller map (MIDI learn)
+    // ------------------------------------------------------------
+    // setControllerMap() may be called from the message thread at
+    // any time; the audio thread adopts the new map at the next
+    // startBlock(). getControllerMap() is the map in use on the
+    // audio thread; getPublishedControllerMap() is the latest edit.
+    // ============================================================
+    void setControllerMap(const ControllerMap& map) { ccMaps_.publish(map); }
+    ControllerMap getPublishedControllerMap() const { return ccMaps_.current(); }
+    const ControllerMap& getControllerMap() const noexcept { return *ccMap_; }
+
     void render(float* buffer, int numSamples)
     {
+        // FTZ/DAZ for offline / test callers too; processBlock already
+        // sets it, and the pool workers set it on their own threads.
+        juce::ScopedNoDenormals noDenormals;
+
+        flushControllers();
+
         std::fill(buffer, buffer + numSamples, 0.0f);
         int activeCount = 0;
 
-        for (auto& v : voices_)
-        {
-            if (v->isActive())
-            {
-                ++activeCount;
-                v->render(buffer, numSamples);
-            }
-        }
+        for (int i = 0; i < static_cast<int>(voices_.size()); ++i)
+            if (voices_[static_cast<size_t>(i)]->isActive())
+                activeVoiceIdx_[static_cast<size_t>(activeCount++)] = i;
 
-        float blockSumSq = std::inner_product(buffer, buffer + numSamples, buffer, 0.0f);
-        float preGainRMS = std::sqrt(blockSumSq / numSamples);
+        const bool parallel = activeCount >= parallelThreshold_
+                           && renderPool_.getNumThreads() > 1
+                           && numSamples <= scratchCapacity_;
 
-        const float targetRMS   = 0.26f;
-        const float eps         = 1e-6f;
-        const float measured    = std::max(preGainRMS, eps);
-        const float ctrl        = juce::jlimit(0.25f, 4.0f, targetRMS / measured);
+        renderMetrics_ = RenderMetrics {};
+        renderMetrics_.activeVoices = activeCount;
 
-        const float prevTarget  = globalGain_.getTargetValue();
-        const float blended     = 0.9f * prevTarget + 0.1f * ctrl;
-        globalGain_.setTargetValue(juce::jlimit(0.25f, 4.0f, blended));
+        if (parallel)
+            renderVoicesParallel(buffer, numSamples, activeCount);
+        else
+            for (int a = 0; a < activeCount; ++a)
+                voices_[static_cast<size_t>(activeVoiceIdx_[static_cast<size_t>(a)])]->render(buffer, numSamples);
 
-        std::ofstream log("voice_debug.txt", std::ios::app);
-        if (!log.is_open())
+        for (int a = 0; a < activeCount; ++a)
         {
-            DBG("VoiceManager: FAILED to open voice_debug.txt");
-            return;
+            const int n = voices_[static_cast<size_t>(activeVoiceIdx_[static_cast<size_t>(a)])]->getSamplesRendered();
+            renderMetrics_.samplesRendered += n < 0 ? numSamples : n;
         }
 
-        log << "[VoiceManager] pre-gain RMS=" << preGainRMS
-            << " start=" << globalGain_.getCurrentValue();
+        // ============================================================
+        // RMS gain control
+        // ------------------------------------------------------------
+        // Measured over agcWindowSamples of output however render() is
+        // sliced (the processor calls it per sub-block), so its time
+        // constant doesn't depend on the sub-block size. The 10 % blend
+        // is per full window; an update that lands late blends by the
+        // samples it actually covers.
+        // ============================================================
+        agcSumSq_   += std::inner_product(buffer, buffer + numSamples, buffer, 0.0f);
+        agcSamples_ += numSamples;
+
+        if (agcSamples_ >= agcWindowSamples)
+        {
+            const float preGainRMS = std::sqrt(agcSumSq_ / static_cast<float>(agcSamples_));
 
-        std::cout << "[DIAG] globalGain start=" << globalGain_.getCurrentValue()
-                  << " end=" << globalGain_.getTargetValue() << std::endl;
+            const float targetRMS   = 0.26f;
+            const float eps         = 1e-6f;
+            const float measured    = std::max(preGainRMS, eps);
+            const float ctrl        = juce::jlimit(0.25f, 4.0f, targetRMS / measured);
+
+            const float keep        = std::pow(0.9f, static_cast<float>(agcSamples_) / agcWindowSamples);
+            const float prevTarget  = globalGain_.getTargetValue();
+            const float blended     = keep * prevTarget + (1.0f - keep) * ctrl;
+            globalGain_.setTargetValue(juce::jlimit(0.25f, 4.0f, blended));
+
+            agcSumSq_   = 0.0f;
+            agcSamples_ = 0;
+
+            DBG("[DIAG] pre-gain RMS=" << preGainRMS
+                << " globalGain start=" << globalGain_.getCurrentValue()
+                << " end=" << globalGain_.getTargetValue());
+        }
 
         for (int i = 0; i < numSamples; ++i)
         {
@@ -337,38 +683,207 @@ public:
         }
 
         float postGainRMS = std::sqrt(std::inner_product(buffer, buffer + numSamples, buffer, 0.0f) / numSamples);
-        DBG("VoiceManager: postGainRMS = " << postGainRMS);
-
-        log << " end=" << globalGain_.getCurrentValue()
-            << " active=" << activeCount << std::endl;
+        DBG("VoiceManager: postGainRMS = " << postGainRMS
+            << " active=" << activeCount);
+        juce::ignoreUnused(postGainRMS);
     }
 
 private:
+    // ============================================================
+    // Parallel render path — per-block task graph
+    // ------------------------------------------------------------
+    //   stage 1: one render task per active voice (work-stolen,
+    //            seeded with last block's measured per-voice cost)
+    //   stage 2: one mix task per chunk of samples, summing the
+    //            scratch rows in voice-slot order; chunks grow in
+    //            mixChunkSamples steps so a block never needs more
+    //            than VoiceRenderPool::maxTasks of them
+    //
+    // Each active voice renders into its own zeroed scratch row.
+    // Since 0.0f + x == x and stage 2 keeps the voice order per
+    // sample, every partial sum matches the serial "buffer += voice"
+    // sequence, so the output is bit-identical to the serial path.
+    //
+    // A single voice can't be split into sample chunks (oscillator
+    // and envelope state are sequential), so a voice is the finest
+    // render task.
+    // ============================================================
+    static constexpr int mixChunkSamples = 64;
+
+    struct ParallelRenderJob
+    {
+        VoiceManager* self = nullptr;
+        float* buffer = nullptr;
+        int numSamples = 0;
+        int activeCount = 0;
+        int chunkSamples = mixChunkSamples;
+    };
+
+    static void renderVoiceTask(void* context, int taskIndex)
+    {
+        const auto& job = *static_cast<const ParallelRenderJob*>(context);
+        auto& self = *job.self;
+
+        float* row = self.scratchRow(taskIndex);
+        std::fill(row, row + job.numSamples, 0.0f);
+
+        const auto voiceIdx = static_cast<size_t>(self.activeVoiceIdx_[static_cast<size_t>(taskIndex)]);
+        self.voices_[voiceIdx]->render(row, job.numSamples);
+    }
+
+    static void mixChunkTask(void* context, int chunkIndex)
+    {
+        const auto& job = *static_cast<const ParallelRenderJob*>(context);
+        const int begin = chunkIndex * job.chunkSamples;
+        const int end   = std::min(job.numSamples, begin + job.chunkSamples);
+
+        // Fixed summation order: voice-slot order, same as serial.
+        for (int a = 0; a < job.activeCount; ++a)
+        {
+            const float* row = job.self->scratchRow(a);
+            for (int i = begin; i < end; ++i)
+                job.buffer[i] += row[i];
+        }
+    }
+
+    void renderVoicesParallel(float* buffer, int numSamples, int activeCount)
+    {
+        // Cost hints from the previous block; slots never measured
+        // (fresh notes) get the mean of the known ones.
+        float knownSum = 0.0f;
+        int   knownCount = 0;
+        for (int a = 0; a < activeCount; ++a)
+        {
+            const float c = voiceCostNs_[static_cast<size_t>(activeVoiceIdx_[static_cast<size_t>(a)])];
+            if (c > 0.0f) { knownSum += c; ++knownCount; }
+        }
+        const float fallbackHint = knownCount > 0 ? knownSum / static_cast<float>(knownCount) : 1.0f;
+
+        for (int a = 0; a < activeCount; ++a)
+        {
+            const float c = voiceCostNs_[static_cast<size_t>(activeVoiceIdx_[static_cast<size_t>(a)])];
+            taskCostHint_[static_cast<size_t>(a)] = c > 0.0f ? c : fallbackHint;
+        }
+
+        const int chunksPerTask = (numSamples + mixChunkSamples * VoiceRenderPool::maxTasks - 1)
+                                / (mixChunkSamples * VoiceRenderPool::maxTasks);
+        ParallelRenderJob job { this, buffer, numSamples, activeCount,
+                                mixChunkSamples * std::max(1, chunksPerTask) };
+
+        // Stage 1 — voices
+        renderPool_.run(&VoiceManager::renderVoiceTask, &job, activeCount,
+                        taskCostHint_.data(), taskCostOut_.data());
+
+        const auto& m = renderPool_.getLastMetrics();
+        renderMetrics_.parallel   = true;
+        renderMetrics_.threads    = m.numThreads;
+        renderMetrics_.steals     = m.steals;
+        renderMetrics_.imbalance  = m.imbalance;
+        renderMetrics_.makespanUs = m.makespanUs;
+
+        for (int a = 0; a < activeCount; ++a)
+            voiceCostNs_[static_cast<size_t>(activeVoiceIdx_[static_cast<size_t>(a)])] = taskCostOut_[static_cast<size_t>(a)];
+
+        // Stage 2 — mix (only worth a handoff for larger blocks)
+        const int numChunks = (numSamples + job.chunkSamples - 1) / job.chunkSamples;
+        if (numChunks >= 2)
+            renderPool_.run(&VoiceManager::mixChunkTask, &job, numChunks);
+        else
+            mixChunkTask(&job, 0);
+    }
+
+    float* scratchRow(int row) noexcept
+    {
+        return voiceScratch_.data() + static_cast<size_t>(row) * static_cast<size_t>(scratchCapacity_);
+    }
+
     // ============================================================
     // Phase III B6 — central voice rebuild helper
     // ============================================================
     void rebuildVoicesForMode()
     {
-        voices_.clear();
-        voices_.reserve(maxVoices);
+        invalidateVoices();
+        voiceCostNs_.fill(0.0f);  // cost hints belong to the old voice types
 
-        // Same factory semantics as before: injectable → fallback.
-        auto makeVoice = [this](VoiceMode m)
+        // Only reached without a prior prepare().
+        if (arena_.capacityBytes() < arenaBytesNeeded())
+            arena_.reserve(arenaBytesNeeded());
+
+        poolMode_ = mode_;
+        const int numVoices = polyphonyForMode(mode_);
+
+        for (int i = 0; i < numVoices; ++i)
         {
+            // Same factory semantics as before: injectable → fallback.
+            // Injected voices are heap-owned; built-in ones live in the arena.
+            BaseVoice* v = nullptr;
             if (voiceFactory_)
-                return voiceFactory_(m);
-            return makeVoiceForMode(m);
-        };
+            {
+                ownedVoices_.push_back(voiceFactory_(mode_));
+                v = ownedVoices_.back().get();
+            }
+            else
+            {
+                v = constructInArena(mode_);
+            }
 
-        for (int i = 0; i < maxVoices; ++i)
-        {
-            auto v = makeVoice(mode_);
-            v->prepare(sampleRate_);
+            if (v == nullptr)
+                break;
 
+            v->prepare(sampleRate_);
             v->setAudioSynthesisEnabled(audioEnabled_);
 
-            voices_.push_back(std::move(v));
+            voices_.push_back(v);
+        }
+    }
+
+    BaseVoice* constructInArena(VoiceMode mode)
+    {
+        return VoiceRegistry::visit(mode, [this](auto tag) -> BaseVoice*
+        {
+            return arena_.construct<typename decltype(tag)::type>();
+        });
+    }
+
+    // ============================================================
+    // Static per-mode dispatch
+    // ------------------------------------------------------------
+    // Arena voices are all of poolMode_'s registered type, so one
+    // visit() resolves the type for the whole loop. Injected voices
+    // (VoiceFactory) may be anything and are resolved dynamically.
+    // ============================================================
+    template <typename Fn>
+    void forEachConcreteVoice(int count, Fn&& fn)
+    {
+        if (!ownedVoices_.empty())
+        {
+            for (int i = 0; i < count; ++i)
+                VoiceRegistry::visitDynamic(*voices_[static_cast<size_t>(i)],
+                                            [&](auto& voice) { fn(i, voice); });
+            return;
         }
+
+        VoiceRegistry::visit(poolMode_, [&](auto tag)
+        {
+            using Voice = typename decltype(tag)::type;
+            for (int i = 0; i < count; ++i)
+                fn(i, *static_cast<Voice*>(voices_[static_cast<size_t>(i)]));
+        });
+    }
+
+    template <typename Fn>
+    void withConcreteVoice(BaseVoice& v, Fn&& fn)
+    {
+        if (!ownedVoices_.empty())
+        {
+            VoiceRegistry::visitDynamic(v, fn);
+            return;
+        }
+
+        VoiceRegistry::visit(poolMode_, [&](auto tag)
+        {
+            fn(static_cast<typename decltype(tag)::type&>(v));
+        });
     }
 
     // ============================================================
@@ -388,12 +903,96 @@ private:
         // Commit the mode change
         lastMode_ = mode_;
 
-        // Rebuild all voices according to the new mode
-        rebuildVoicesForMode();
+        // Drop the old mode's voices; the new pool is built lazily
+        invalidateVoices();
+    }
+
+    void invalidateVoices()
+    {
+        voices_.clear();
+        arena_.clear();
+        ownedVoices_.clear();
+        voicesReady_ = false;
+
+        channelVoice_.fill(-1);
+        voiceChannel_.fill(0);
+    }
+
+    // Replays the controller changes an idle voice missed (only active
+    // voices are called by flushControllers()).
+    void syncControllers(int voiceIdx)
+    {
+        const uint32_t seen = voiceCcEpoch_[static_cast<size_t>(voiceIdx)];
+        if (seen == ccEpochNow_)
+            return;
+
+        auto* v = voices_[static_cast<size_t>(voiceIdx)];
+        for (int t = 0; t < numCcTargets; ++t)
+            if (controlEpoch_[static_cast<size_t>(t)] > seen)
+                v->handleController(voiceControlFor(static_cast<CcTarget>(t)), lastControlValue_[static_cast<size_t>(t)]);
+
+        voiceCcEpoch_[static_cast<size_t>(voiceIdx)] = ccEpochNow_;
+    }
+
+    // ============================================================
+    // MPE channel ↔ voice tables
+    // ============================================================
+    NoteExpression& channelExpr(int channel) noexcept
+    {
+        return channelExpr_[static_cast<size_t>(channel)];
     }
 
-    std::vector<std::unique_ptr<BaseVoice>> voices_;
-    const ParameterSnapshot* currentSnapshot_ = nullptr;
+    void assignChannel(int voiceIdx, int channel) noexcept
+    {
+        // The voice's previous channel (if any) no longer points at it.
+        const int old = voiceChannel_[static_cast<size_t>(voiceIdx)];
+        if (old > 0 && channelVoice_[static_cast<size_t>(old)] == voiceIdx)
+            channelVoice_[static_cast<size_t>(old)] = -1;
+
+        voiceChannel_[static_cast<size_t>(voiceIdx)] = channel;
+        if (channel > 0)
+            channelVoice_[static_cast<size_t>(channel)] = voiceIdx;
+    }
+
+    // Member-channel voices: their channel's values, plus master bend.
+    // Other voices: the master values.
+    NoteExpression expressionForVoice(int voiceIdx) const noexcept
+    {
+        const int ch = voiceChannel_[static_cast<size_t>(voiceIdx)];
+        if (ch <= 0)
+            return masterExpr_;
+
+        NoteExpression e = channelExpr_[static_cast<size_t>(ch)];
+        e.bendSemis += masterExpr_.bendSemis;
+        return e;
+    }
+
+    void pushExpression(int voiceIdx, bool immediate)
+    {
+        voices_[static_cast<size_t>(voiceIdx)]->setExpression(expressionForVoice(voiceIdx), immediate);
+    }
+
+    void pushChannelExpression(int channel)
+    {
+        const int idx = getVoiceForChannel(channel);
+        if (idx >= 0)
+            pushExpression(idx, false);
+    }
+
+    void pushExpressionToAll()
+    {
+        for (int i = 0; i < static_cast<int>(voices_.size()); ++i)
+            pushExpression(i, false);
+    }
+
+    // Live pool in slot order: arena voices, or injected ones owned
+    // by ownedVoices_.
+    std::vector<BaseVoice*> voices_;
+    VoiceArena arena_;
+    VoiceMode  poolMode_ = VoiceMode::VoiceA;   // type of every arena voice
+    std::vector<std::unique_ptr<BaseVoice>> ownedVoices_;
+    const ParameterSnapshot* currentSnapshot_ = nullptr;   // &blockSnapshot_ once started
+    ParameterSnapshot blockSnapshot_;
     SnapshotMaker makeSnapshot_;  // stored callback
 
     // Optional, mode-aware voice factory (B4). If empty, we defer to makeVoiceForMode().
@@ -412,11 +1011,23 @@ private:
         float envAttack  = 0.01f;
         float envRelease = 0.20f;
         float oscFreq    = 440.0f;
+        float relVelocity = 0.0f;   // VoiceLET v/c (control 6)
+
+        // Set once a controller has driven the field; until then
+        // voices keep their per-voice group values.
+        bool envAttackSet  = false;
+        bool envReleaseSet = false;
+        bool oscFreqSet    = false;
     } ccCache;
 
     double sampleRate_ = 48000.0;
     juce::SmoothedValue<float> globalGain_{ 1.0f }; // clickless poly gain
 
+    // RMS gain control accumulators (see render()).
+    static constexpr int agcWindowSamples = 512;
+    float agcSumSq_   = 0.0f;
+    int   agcSamples_ = 0;
+
     // ============================================================
     // Phase IV A11-1 — internal propagation helper
     // ============================================================
@@ -431,4 +1042,60 @@ private:
 
     // Stored runtime mode (default false = math-mode)
     bool audioEnabled_ = false;
+
+    // ============================================================
+    // MPE state (index = MIDI channel 1 … 16; 0 unused)
+    // ============================================================
+    int mpeMemberChannels_ = 0;
+    NoteExpression masterExpr_;
+    std::array<NoteExpression, numMidiChannels + 1> channelExpr_ {};
+    std::array<int, numMidiChannels + 1> channelVoice_ = makeNoChannelVoices();
+    std::array<int, maxVoices> voiceChannel_ {};   // 0 = not on a member channel
+
+    static std::array<int, numMidiChannels + 1> makeNoChannelVoices() noexcept
+    {
+        std::array<int, numMidiChannels + 1> a {};
+        a.fill(-1);
+        return a;
+    }
+
+    // ============================================================
+    // Lazy voice pool state
+    // ============================================================
+    bool voicesReady_ = false;
+
+    // Controller map / coalescing. Voice-side state is kept per
+    // target, so remapping a CC never replays a stale number:
+    // controlEpoch_[t] stamps the last fan-out of each target and
+    // voiceCcEpoch_[v] is how far voice v is current, so a note start
+    // replays only what it missed.
+    ControllerMapExchange ccMaps_;
+    const ControllerMap*  ccMap_ = &ccMaps_.acquire();
+    ControllerCoalescer   ccQueue_;
+    ControllerStats       ccStats_;
+    uint32_t ccEpochNow_ = 0;
+    std::array<float, numCcTargets>    lastControlValue_ = makeUnsetControls();
+    std::array<uint32_t, numCcTargets> controlEpoch_ {};
+    std::array<uint32_t, maxVoices>    voiceCcEpoch_ {};
+
+    static std::array<float, numCcTargets> makeUnsetControls() noexcept
+    {
+        std::array<float, numCcTargets> a {};
+        a.fill(-1.0f);   // never received
+        return a;
+    }
+
+    // ============================================================
+    // Parallel voice rendering state
+    // ============================================================
+    VoiceRenderPool renderPool_;
+    std::vector<float> voiceScratch_;           // maxVoices rows × scratchCapacity_
+    int scratchCapacity_   = 0;
+    std::array<int, maxVoices> activeVoiceIdx_ {};
+    std::array<float, maxVoices> voiceCostNs_ {};   // per voice slot, last measured render cost
+    std::array<float, maxVoices> taskCostHint_ {};  // per task, gathered from voiceCostNs_
+    std::array<float, maxVoices> taskCostOut_ {};   // per task, measured this block
+    RenderMetrics renderMetrics_;
+    int numRenderThreads_  = 1;   // serial; see suggestedNumRenderThreads()
+    int parallelThreshold_ = 8;
 };
@@ -0,0 +1,243 @@
+#pragma once
+#include "dsp/BaseVoice.h"
+#include "dsp/VoiceArena.h"
+#include "dsp/voices/VoiceA.h"
+#include "dsp/voices/VoiceDopp.h"
+#include "dsp/voices/VoiceLET.h"
+#include "dsp/voices/VoiceFM.h"
+#include "dsp/voices/VoiceEns.h"
+#include "params/ParameterSnapshot.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+// ============================================================
+// VoiceRegistry — compile-time list of voice types
+// ------------------------------------------------------------
+// One VoiceTraits<> specialisation per voice type; VoiceTypes lists
+// them in VoiceMode order. Everything mode-dependent is generated
+// from that list:
+//   - VoiceMode ↔ type mapping (checked against the enum)
+//   - per-mode polyphony, sizeof and arena bytes
+//   - static dispatch: visit(mode, fn) calls fn(VoiceTag<Voice>{})
+//   - the "Voice Mode" choice names (ParamLayout)
+//
+// A thin runtime lookup by name (linear scan, no hashing) remains
+// for tooling: makeVoice("voiceFM").
+// ============================================================
+
+inline constexpr int maxPoolVoices = 32;
+
+template <typename Voice>
+struct VoiceTraits;
+
+template <>
+struct VoiceTraits<VoiceA>
+{
+    static constexpr VoiceMode   mode         = VoiceMode::VoiceA;
+    static constexpr const char* name         = "voiceA";
+    static constexpr const char* displayName  = "VoiceA";
+    static constexpr int         maxPolyphony = maxPoolVoices;
+    static constexpr bool        blockRender  = false;   // per-sample osc × env loop
+};
+
+template <>
+struct VoiceTraits<VoiceDopp>
+{
+    static constexpr VoiceMode   mode         = VoiceMode::VoiceDopp;
+    static constexpr const char* name         = "voiceDopp";
+    static constexpr const char* displayName  = "VoiceDopp";
+    static constexpr int         maxPolyphony = maxPoolVoices;
+    static constexpr bool        blockRender  = true;    // per-block geometry, oversampled
+};
+
+template <>
+struct VoiceTraits<VoiceLET>
+{
+    static constexpr VoiceMode   mode         = VoiceMode::VoiceLET;
+    static constexpr const char* name         = "voiceLET";
+    static constexpr const char* displayName  = "VoiceLET";
+    static constexpr int         maxPolyphony = maxPoolVoices;
+    static constexpr bool        blockRender  = true;
+};
+
+template <>
+struct VoiceTraits<VoiceFM>
+{
+    static constexpr VoiceMode   mode         = VoiceMode::VoiceFM;
+    static constexpr const char* name         = "voiceFM";
+    static constexpr const char* displayName  = "VoiceFM";
+    static constexpr int         maxPolyphony = maxPoolVoices;
+    static constexpr bool        blockRender  = true;    // per-algorithm chunk kernels
+};
+
+template <>
+struct VoiceTraits<VoiceEns>
+{
+    static constexpr VoiceMode   mode         = VoiceMode::VoiceEns;
+    static constexpr const char* name         = "voiceEns";
+    static constexpr const char* displayName  = "VoiceEns";
+    static constexpr int         maxPolyphony = std::min(maxPoolVoices, VoiceEns::polyphonyLimit(VoiceEns::defaultBands));
+    static constexpr bool        blockRender  = true;    // SIMD band bank over chunks
+};
+
+template <typename Voice>
+struct VoiceTag
+{
+    using type = Voice;
+};
+
+template <typename... Voices>
+class VoiceTypeList {
+public:
+    static constexpr int size = static_cast<int>(sizeof...(Voices));
+
+    // Calls fn(VoiceTag<Voice>{}) for the type registered at `mode`
+    // (falls back to the first type for out-of-range values).
+    template <typename Fn>
+    static decltype(auto) visit(VoiceMode mode, Fn&& fn)
+    {
+        const int index = indexOf(mode);
+        return visitIndex(index, std::forward<Fn>(fn), std::index_sequence_for<Voices...> {});
+    }
+
+    // Resolves an arbitrary voice's concrete type (injected voices).
+    // Calls fn(Voice&) for the first listed type it casts to.
+    template <typename Fn>
+    static bool visitDynamic(BaseVoice& voice, Fn&& fn)
+    {
+        return (tryVisit<Voices>(voice, fn) || ...);
+    }
+
+    template <typename Fn>
+    static void forEach(Fn&& fn)
+    {
+        (fn(VoiceTag<Voices> {}), ...);
+    }
+
+    static constexpr int maxPolyphony(VoiceMode mode) noexcept
+    {
+        constexpr int values[] = { VoiceTraits<Voices>::maxPolyphony... };
+        return values[indexOf(mode)];
+    }
+
+    static constexpr size_t voiceBytes(VoiceMode mode) noexcept
+    {
+        constexpr size_t values[] = { sizeof(Voices)... };
+        return values[indexOf(mode)];
+    }
+
+    static constexpr size_t arenaBytes(VoiceMode mode) noexcept
+    {
+        constexpr size_t values[] = { VoiceArena::slotBytes<Voices>() * static_cast<size_t>(VoiceTraits<Voices>::maxPolyphony)... };
+        return values[indexOf(mode)];
+    }
+
+    static constexpr size_t maxArenaBytes() noexcept
+    {
+        size_t bytes = 0;
+        for (int i = 0; i < size; ++i)
+            bytes = std::max(bytes, arenaBytes(static_cast<VoiceMode>(i)));
+        return bytes;
+    }
+
+    static constexpr bool supportsBlockRender(VoiceMode mode) noexcept
+    {
+        constexpr bool values[] = { VoiceTraits<Voices>::blockRender... };
+        return values[indexOf(mode)];
+    }
+
+    static constexpr const char* name(VoiceMode mode) noexcept
+    {
+        constexpr const char* values[] = { VoiceTraits<Voices>::name... };
+        return values[indexOf(mode)];
+    }
+
+    static constexpr const char* displayName(VoiceMode mode) noexcept
+    {
+        constexpr const char* values[] = { VoiceTraits<Voices>::displayName... };
+        return values[indexOf(mode)];
+    }
+
+    // ------------------------------------------------------------
+    // Runtime lookup (tooling)
+    // ------------------------------------------------------------
+    static bool findMode(std::string_view name, VoiceMode& out) noexcept
+    {
+        for (int i = 0; i < size; ++i)
+        {
+            if (name == VoiceTypeList::name(static_cast<VoiceMode>(i)))
+            {
+                out = static_cast<VoiceMode>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static std::unique_ptr<BaseVoice> makeVoice(VoiceMode mode)
+    {
+        return visit(mode, [](auto tag) -> std::unique_ptr<BaseVoice>
+        {
+            return std::make_unique<typename decltype(tag)::type>();
+        });
+    }
+
+    static std::unique_ptr<BaseVoice> makeVoice(std::string_view name)
+    {
+        VoiceMode mode;
+        return findMode(name, mode) ? makeVoice(mode) : nullptr;
+    }
+
+private:
+    static constexpr int indexOf(VoiceMode mode) noexcept
+    {
+        const int i = static_cast<int>(mode);
+        return (i >= 0 && i < size) ? i : 0;
+    }
+
+    template <typename Fn, size_t... I>
+    static decltype(auto) visitIndex(int index, Fn&& fn, std::index_sequence<I...>)
+    {
+        using Result = decltype(fn(VoiceTag<std::tuple_element_t<0, std::tuple<Voices...>>> {}));
+        using Thunk  = Result (*)(Fn&);
+
+        static constexpr Thunk table[] = {
+            [](Fn& f) -> Result { return f(VoiceTag<std::tuple_element_t<I, std::tuple<Voices...>>> {}); }...
+        };
+        return table[index](fn);
+    }
+
+    template <typename Voice, typename Fn>
+    static bool tryVisit(BaseVoice& voice, Fn& fn)
+    {
+        if (auto* v = dynamic_cast<Voice*>(&voice))
+        {
+            fn(*v);
+            return true;
+        }
+        return false;
+    }
+
+    template <size_t... I>
+    static constexpr bool modesMatchOrder(std::index_sequence<I...>) noexcept
+    {
+        return ((static_cast<int>(VoiceTraits<Voices>::mode) == static_cast<int>(I)) && ...);
+    }
+
+public:
+    static constexpr bool inModeOrder() noexcept
+    {
+        return modesMatchOrder(std::index_sequence_for<Voices...> {});
+    }
+};
+
+// The registry: order must match VoiceMode.
+using VoiceRegistry = VoiceTypeList<VoiceA, VoiceDopp, VoiceLET, VoiceFM, VoiceEns>;
+
+static_assert(VoiceRegistry::size == numVoiceModes, "every VoiceMode needs a registered voice type");
+static_assert(VoiceRegistry::inModeOrder(), "VoiceRegistry must list voices in VoiceMode order");
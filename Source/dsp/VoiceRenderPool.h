@@ -0,0 +1,540 @@
+#pragma once
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <algorithm>
+
+#if JUCE_LINUX || JUCE_ANDROID
+ #include <linux/futex.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#endif
+
+// ============================================================
+// VoiceRenderPool — fixed real-time worker pool for voice rendering
+// ------------------------------------------------------------
+// Design goals:
+//  • Threads are spawned once (message thread, from prepare()),
+//    never on the audio thread, and never while run() is active.
+//  • Workers are juce::Threads started with real-time priority
+//    (plain highest priority where the OS refuses), so a render
+//    share is not preempted by ordinary application threads.
+//  • run() performs no allocations. On Linux it takes no locks at
+//    all: parked workers sleep on a futex and run() wakes them with
+//    one syscall. Elsewhere a parked worker is woken through a
+//    condition variable, whose mutex run() takes only when some
+//    worker is actually parked.
+//  • Handoff is spin-then-block: workers spin on a generation
+//    counter for a short while after each job, then park.
+//  • The calling (audio) thread participates as participant 0.
+//  • Workers run with flush-to-zero / denormals-are-zero set for
+//    their whole lifetime, same as the audio thread.
+//
+// Scheduling is work-stealing: before a job is published the
+// caller deals tasks onto one bounded Chase–Lev deque per
+// participant, longest-expected-first (LPT) using the cost hints
+// from the previous block. Owners pop their own deque; idle
+// participants steal from the others. Every worker acknowledges
+// every job, so a new job is never published while a worker still
+// reads the previous one. Tasks must write to disjoint memory.
+//
+// Typical usage:
+//   pool.start(3);                                     // prepare()
+//   pool.run(&renderOne, this, numActive, costs, out); // audio thread
+// ============================================================
+
+class VoiceRenderPool {
+public:
+    using TaskFn = void (*)(void* context, int taskIndex);
+
+    static constexpr int maxWorkers = 15;
+    static constexpr int maxTasks   = 64;
+
+    // Per-job scheduling diagnostics (valid after run() returns).
+    struct Metrics
+    {
+        int    numTasks   = 0;
+        int    numThreads = 1;
+        int    steals     = 0;
+        double imbalance  = 1.0;   // max participant busy time / mean (1 = perfect)
+        double makespanUs = 0.0;   // busiest participant, microseconds
+    };
+
+    VoiceRenderPool() = default;
+    ~VoiceRenderPool() { stop(); }
+
+    VoiceRenderPool(const VoiceRenderPool&) = delete;
+    VoiceRenderPool& operator=(const VoiceRenderPool&) = delete;
+
+    // ------------------------------------------------------------
+    // Lifecycle (message thread only, never concurrently with run())
+    // ------------------------------------------------------------
+    void start(int numWorkers)
+    {
+        numWorkers = std::clamp(numWorkers, 0, maxWorkers);
+
+        if (numWorkers == numWorkers_)
+            return;
+
+        stop();
+
+        stopping_.store(false);
+        numWorkers_ = numWorkers;
+
+        // Workers start from the current generation so a job published
+        // before a thread is scheduled is still picked up.
+        const uint32_t startGen = generation_.load();
+
+        for (int w = 0; w < numWorkers_; ++w)
+        {
+            auto& worker = workers_[static_cast<size_t>(w)];
+            worker = std::make_unique<Worker>(*this, w + 1, startGen);
+
+            if (! worker->startRealtimeThread(juce::Thread::RealtimeOptions{}.withPriority(realtimePriority)))
+                worker->startThread(juce::Thread::Priority::highest);
+        }
+    }
+
+    void stop()
+    {
+        if (numWorkers_ == 0)
+            return;
+
+        for (int w = 0; w < numWorkers_; ++w)
+            workers_[static_cast<size_t>(w)]->signalThreadShouldExit();
+
+        stopping_.store(true);
+        wakeAll();
+
+        for (int w = 0; w < numWorkers_; ++w)
+        {
+            workers_[static_cast<size_t>(w)]->waitForThreadToExit(-1);
+            workers_[static_cast<size_t>(w)].reset();
+        }
+
+        numWorkers_ = 0;
+    }
+
+    // Worker threads plus the calling thread.
+    int getNumThreads() const noexcept { return numWorkers_ + 1; }
+
+    const Metrics& getLastMetrics() const noexcept { return metrics_; }
+
+    // ------------------------------------------------------------
+    // run() — execute fn(context, t) for t in [0, numTasks).
+    // Blocks until every task has completed. Audio thread only.
+    // At most maxTasks fit the deques; a larger job is a caller bug
+    // (asserted) and runs serially on the caller rather than losing
+    // tasks.
+    //
+    // costHints (optional): expected relative cost per task, used
+    //   to seed the deques. Without hints all tasks weigh the same.
+    // costsOut  (optional): measured cost per task in nanoseconds,
+    //   suitable as next block's costHints.
+    // ------------------------------------------------------------
+    void run(TaskFn fn, void* context, int numTasks,
+             const float* costHints = nullptr, float* costsOut = nullptr)
+    {
+        if (numTasks <= 0)
+            return;
+
+        jassert(numTasks <= maxTasks);
+
+        const int participants = getNumThreads();
+
+        jobFn_       = fn;
+        jobContext_  = context;
+        jobCostsOut_ = numTasks <= maxTasks ? costsOut : nullptr;
+
+        if (participants <= 1 || numTasks == 1 || numTasks > maxTasks)
+        {
+            for (int t = 0; t < numTasks; ++t)
+                executeTask(t);
+
+            metrics_ = Metrics { numTasks, 1, 0, 1.0, 0.0 };
+            return;
+        }
+
+        // Publish job fields before bumping the generation.
+        jobParticipants_ = participants;
+        seedDeques(numTasks, participants, costHints);
+
+        for (int p = 0; p < participants; ++p)
+        {
+            lanes_[static_cast<size_t>(p)].busyNs = 0;
+            lanes_[static_cast<size_t>(p)].steals = 0;
+        }
+
+        pending_.store(participants - 1, std::memory_order_relaxed);
+
+        generation_.fetch_add(1);  // seq_cst: pairs with sleepers_ below
+
+        if (sleepers_.load() > 0)
+            wakeAll();
+
+        // Caller is participant 0.
+        executeShare(0);
+
+        // Wait for the workers' shares.
+        for (int spins = 0; pending_.load(std::memory_order_acquire) > 0; ++spins)
+        {
+            if (spins > spinIterations)
+                std::this_thread::yield();
+        }
+
+        collectMetrics(numTasks, participants);
+    }
+
+private:
+    // Number of polls before a worker parks / the caller yields.
+    static constexpr int spinIterations = 4096;
+
+    // juce::Thread real-time priority, 0 … 10 (the audio callback
+    // itself runs above this on every platform).
+    static constexpr int realtimePriority = 8;
+
+    using Clock = std::chrono::steady_clock;
+
+    // ============================================================
+    // Bounded Chase–Lev deque of task indices.
+    // Filled by the caller between jobs (no concurrent access),
+    // then drained by its owner (popBottom) and thieves (steal).
+    // ============================================================
+    struct alignas(64) Deque
+    {
+        std::atomic<int> top    { 0 };
+        std::atomic<int> bottom { 0 };
+        std::array<int, maxTasks> tasks {};
+
+        void reset() noexcept
+        {
+            top.store(0, std::memory_order_relaxed);
+            bottom.store(0, std::memory_order_relaxed);
+        }
+
+        void pushUnsynchronised(int task) noexcept
+        {
+            const int b = bottom.load(std::memory_order_relaxed);
+            tasks[static_cast<size_t>(b)] = task;
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        // Owner only. Returns -1 when empty.
+        int popBottom() noexcept
+        {
+            const int b = bottom.load(std::memory_order_relaxed) - 1;
+            bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            int t = top.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                bottom.store(b + 1, std::memory_order_relaxed);
+                return -1;
+            }
+
+            int task = tasks[static_cast<size_t>(b)];
+
+            if (t == b)
+            {
+                // Last element: race against thieves.
+                if (! top.compare_exchange_strong(t, t + 1,
+                                                  std::memory_order_seq_cst,
+                                                  std::memory_order_relaxed))
+                    task = -1;
+
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+
+            return task;
+        }
+
+        // Any thread. Returns -1 when empty or on a lost race.
+        int steal() noexcept
+        {
+            int t = top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const int b = bottom.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return -1;
+
+            const int task = tasks[static_cast<size_t>(t)];
+
+            if (! top.compare_exchange_strong(t, t + 1,
+                                              std::memory_order_seq_cst,
+                                              std::memory_order_relaxed))
+                return -1;
+
+            return task;
+        }
+
+        bool looksEmpty() const noexcept
+        {
+            return top.load(std::memory_order_acquire) >= bottom.load(std::memory_order_acquire);
+        }
+    };
+
+    // Per-participant counters, one cache line each.
+    struct alignas(64) Lane
+    {
+        int64_t busyNs = 0;
+        int     steals = 0;
+    };
+
+    // ------------------------------------------------------------
+    // LPT seeding: tasks sorted by descending hint are dealt to the
+    // participant with the least expected load so far. Deques are
+    // filled so the owner starts on its largest task while thieves
+    // take the smallest remaining ones from the top.
+    // ------------------------------------------------------------
+    void seedDeques(int numTasks, int participants, const float* costHints) noexcept
+    {
+        auto hint = [costHints](int t) { return costHints != nullptr ? costHints[t] : 1.0f; };
+
+        std::array<int, maxTasks> order {};
+        for (int t = 0; t < numTasks; ++t)
+            order[static_cast<size_t>(t)] = t;
+
+        // Insertion sort: numTasks ≤ maxTasks, no allocation.
+        for (int i = 1; i < numTasks; ++i)
+        {
+            const int key = order[static_cast<size_t>(i)];
+            int j = i - 1;
+            while (j >= 0 && hint(order[static_cast<size_t>(j)]) < hint(key))
+            {
+                order[static_cast<size_t>(j + 1)] = order[static_cast<size_t>(j)];
+                --j;
+            }
+            order[static_cast<size_t>(j + 1)] = key;
+        }
+
+        std::array<float, maxWorkers + 1> load {};
+        std::array<int,   maxWorkers + 1> counts {};
+
+        for (int i = 0; i < numTasks; ++i)
+        {
+            const int t = order[static_cast<size_t>(i)];
+
+            int target = 0;
+            for (int p = 1; p < participants; ++p)
+                if (load[static_cast<size_t>(p)] < load[static_cast<size_t>(target)])
+                    target = p;
+
+            load[static_cast<size_t>(target)] += std::max(hint(t), 1.0e-3f);
+
+            auto& row = assigned_[static_cast<size_t>(target)];
+            row[static_cast<size_t>(counts[static_cast<size_t>(target)]++)] = t;
+        }
+
+        for (int p = 0; p < participants; ++p)
+        {
+            auto& dq = deques_[static_cast<size_t>(p)];
+            const auto& row = assigned_[static_cast<size_t>(p)];
+
+            dq.reset();
+            for (int k = counts[static_cast<size_t>(p)] - 1; k >= 0; --k)
+                dq.pushUnsynchronised(row[static_cast<size_t>(k)]);
+        }
+    }
+
+    void executeTask(int t) noexcept
+    {
+        if (jobCostsOut_ == nullptr)
+        {
+            jobFn_(jobContext_, t);
+            return;
+        }
+
+        const auto t0 = Clock::now();
+        jobFn_(jobContext_, t);
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+        jobCostsOut_[t] = static_cast<float>(ns);
+    }
+
+    void executeShare(int participant) noexcept
+    {
+        auto& lane = lanes_[static_cast<size_t>(participant)];
+        auto& own  = deques_[static_cast<size_t>(participant)];
+        const auto t0 = Clock::now();
+
+        // Own work first.
+        for (int t = own.popBottom(); t >= 0; t = own.popBottom())
+            executeTask(t);
+
+        // Then steal until every deque is drained.
+        for (bool anyLeft = true; anyLeft;)
+        {
+            anyLeft = false;
+            for (int k = 1; k < jobParticipants_; ++k)
+            {
+                auto& victim = deques_[static_cast<size_t>((participant + k) % jobParticipants_)];
+                if (victim.looksEmpty())
+                    continue;
+
+                anyLeft = true;
+                const int t = victim.steal();
+                if (t >= 0)
+                {
+                    ++lane.steals;
+                    executeTask(t);
+                }
+            }
+        }
+
+        lane.busyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count();
+    }
+
+    void collectMetrics(int numTasks, int participants) noexcept
+    {
+        int64_t maxNs = 0;
+        int64_t sumNs = 0;
+        int steals = 0;
+
+        for (int p = 0; p < participants; ++p)
+        {
+            const auto& lane = lanes_[static_cast<size_t>(p)];
+            maxNs = std::max(maxNs, lane.busyNs);
+            sumNs += lane.busyNs;
+            steals += lane.steals;
+        }
+
+        const double meanNs = static_cast<double>(sumNs) / participants;
+
+        metrics_.numTasks   = numTasks;
+        metrics_.numThreads = participants;
+        metrics_.steals     = steals;
+        metrics_.imbalance  = meanNs > 0.0 ? static_cast<double>(maxNs) / meanNs : 1.0;
+        metrics_.makespanUs = static_cast<double>(maxNs) * 1.0e-3;
+    }
+
+    // ------------------------------------------------------------
+    // Worker thread: runs workerLoop() until stop().
+    // ------------------------------------------------------------
+    class Worker : public juce::Thread
+    {
+    public:
+        Worker(VoiceRenderPool& pool, int participant, uint32_t startGen)
+            : juce::Thread("Voice render " + juce::String(participant)),
+              pool_(pool), participant_(participant), startGen_(startGen) {}
+
+        void run() override { pool_.workerLoop(participant_, startGen_); }
+
+    private:
+        VoiceRenderPool& pool_;
+        const int        participant_;
+        const uint32_t   startGen_;
+    };
+
+    // ------------------------------------------------------------
+    // Parking. wakeWord_ changes on every publish and on stop(), so
+    // a worker that read it before re-checking its wake condition
+    // can never sleep through the wake that follows.
+    // ------------------------------------------------------------
+    void park(uint32_t word, uint32_t seen)
+    {
+       #if JUCE_LINUX || JUCE_ANDROID
+        juce::ignoreUnused(seen);
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&wakeWord_),
+                FUTEX_WAIT_PRIVATE, word, nullptr, nullptr, 0);
+       #else
+        juce::ignoreUnused(word);
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wakeCv_.wait(lock, [&] {
+            return stopping_.load() || generation_.load() != seen;
+        });
+       #endif
+    }
+
+    void wakeAll()
+    {
+        wakeWord_.fetch_add(1);
+
+       #if JUCE_LINUX || JUCE_ANDROID
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&wakeWord_),
+                FUTEX_WAKE_PRIVATE, maxWorkers, nullptr, nullptr, 0);
+       #else
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        wakeCv_.notify_all();
+       #endif
+    }
+
+    void workerLoop(int participant, uint32_t seen)
+    {
+        // FTZ/DAZ is per-thread state; set it once for this worker.
+        juce::FloatVectorOperations::disableDenormalisedNumberSupport();
+
+        for (;;)
+        {
+            // --- spin phase ---
+            uint32_t gen = generation_.load(std::memory_order_acquire);
+            for (int spins = 0; gen == seen && spins < spinIterations; ++spins)
+            {
+                if (stopping_.load(std::memory_order_relaxed))
+                    break;
+                gen = generation_.load(std::memory_order_acquire);
+            }
+
+            // --- block phase ---
+            // sleepers_ is raised before the final check (all seq_cst),
+            // so run() either sees a sleeper and wakes, or this thread
+            // sees the new generation and does not park.
+            while (gen == seen && ! stopping_.load())
+            {
+                const uint32_t word = wakeWord_.load();
+                sleepers_.fetch_add(1);
+
+                if (generation_.load() == seen && ! stopping_.load())
+                    park(word, seen);
+
+                sleepers_.fetch_sub(1);
+                gen = generation_.load(std::memory_order_acquire);
+            }
+
+            // A job published before stop() is still worked and
+            // acknowledged, so run() never waits on a worker that left.
+            if (gen != seen)
+            {
+                seen = gen;
+
+                executeShare(participant);
+                pending_.fetch_sub(1, std::memory_order_release);
+                continue;
+            }
+
+            if (stopping_.load())
+                return;
+        }
+    }
+
+    std::array<std::unique_ptr<Worker>, maxWorkers> workers_ {};
+    int numWorkers_ = 0;
+
+    // Job description (written by run() before generation_ bump)
+    TaskFn jobFn_           = nullptr;
+    void*  jobContext_      = nullptr;
+    float* jobCostsOut_     = nullptr;
+    int    jobParticipants_ = 0;
+
+    std::array<Deque, maxWorkers + 1> deques_ {};
+    std::array<Lane,  maxWorkers + 1> lanes_  {};
+    std::array<std::array<int, maxTasks>, maxWorkers + 1> assigned_ {};  // seeding scratch
+    Metrics metrics_;
+
+    // Keep the hot atomics on their own cache lines.
+    alignas(64) std::atomic<uint32_t> generation_ { 0 };
+    alignas(64) std::atomic<int>      pending_    { 0 };
+    alignas(64) std::atomic<int>      sleepers_   { 0 };
+    alignas(64) std::atomic<uint32_t> wakeWord_   { 0 };
+    std::atomic<bool>                 stopping_   { false };
+
+    // Parking fallback where there is no futex.
+    std::mutex              sleepMutex_;
+    std::condition_variable wakeCv_;
+};
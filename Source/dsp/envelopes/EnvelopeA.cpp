@@ -2,6 +2,12 @@
 #include "EnvelopeA.h"
 #include <cmath>
 
+namespace
+{
+    // Release decays geometrically to this level, then the tail ends.
+    constexpr double releaseFloor = 1e-5;
+}
+
 void EnvelopeA::prepare(double sr)
 {
     sampleRate_ = sr;
@@ -11,27 +17,78 @@ void EnvelopeA::prepare(double sr)
 
 void EnvelopeA::setAttack(float seconds)
 {
-    attackInc_ = (seconds > 0.0f) ? (1.0 / (seconds * sampleRate_)) : 1.0;
+    shape_.attackSec = std::max(0.0f, seconds);
+    computeIncrements();
+}
+
+void EnvelopeA::setDecay(float seconds)
+{
+    shape_.decaySec = std::max(0.0f, seconds);
+    computeIncrements();
+}
+
+void EnvelopeA::setSustain(float level)
+{
+    shape_.sustainLevel = std::clamp(level, 0.0f, 1.0f);
+}
+
+void EnvelopeA::setCurves(EnvelopeCurve attack, EnvelopeCurve decay)
+{
+    shape_.attackCurve = attack;
+    shape_.decayCurve  = decay;
+}
+
+// Segment reciprocals in samples: the render loops only add.
+void EnvelopeA::computeIncrements()
+{
+    shape_.update();
+    attackInc_ = shape_.attackSec > 0.0 ? 1.0 / (shape_.attackSec * sampleRate_) : 1.0;
+    decayInc_  = shape_.decaySec  > 0.0 ? 1.0 / (shape_.decaySec  * sampleRate_) : 0.0;
 }
 
 void EnvelopeA::setRelease(float seconds)
 {
     releaseSeconds_ = std::max(0.0f, seconds);
+    shape_.releaseSec = releaseSeconds_;
+    shape_.update();
 
     if (releaseSeconds_ == 0.0f)
     {
         releaseCoef_ = 0.0;
-        return;
+    }
+    else
+    {
+        const double N = releaseSeconds_ * sampleRate_;
+        releaseCoef_ = std::exp(std::log(releaseFloor) / N);
+    }
+
+    // A release-time change mid-tail moves the end of the tail.
+    if (state_ == State::Release)
+        computeReleaseEnd();
+}
+
+// The tail ends at whichever comes first: the nominal release length,
+// or the sample at which level * coef^n crosses releaseFloor. Computed
+// once here, so the release loop only counts samples.
+void EnvelopeA::computeReleaseEnd()
+{
+    const auto nominalEnd = static_cast<uint64_t>(releaseSeconds_ * sampleRate_);
+
+    uint64_t levelEnd = releaseSamples_ + 1;
+    if (releaseCoef_ > 0.0 && releaseCoef_ < 1.0 && level_ > releaseFloor)
+    {
+        const double n = std::ceil(std::log(releaseFloor / level_) / std::log(releaseCoef_));
+        levelEnd = releaseSamples_ + static_cast<uint64_t>(std::max(1.0, n));
     }
 
-    const double N = releaseSeconds_ * sampleRate_;
-    releaseCoef_ = std::exp(std::log(1e-5) / N);
+    releaseEndSample_ = std::max(releaseSamples_ + 1, std::min(levelEnd, nominalEnd));
 }
 
 void EnvelopeA::noteOn()
 {
     state_ = State::Attack;
     level_ = 0.0;
+    phase_ = 0.0;
     releaseSamples_ = 0;
 }
 
@@ -43,55 +100,128 @@ void EnvelopeA::noteOff()
         state_ = State::Release;
         releaseStartLevel_ = level_;
         releaseSamples_ = 0;
+        computeReleaseEnd();
+    }
+}
+
+// Peak reached this sample. Without a decay the sample is the peak;
+// with one, the attack's overshoot carries into the decay so the
+// samples stay on AdsrShape::heldLevelAt().
+void EnvelopeA::endAttack()
+{
+    level_ = 1.0;
+
+    if (decayInc_ <= 0.0)
+    {
+        state_ = State::Sustain;
+        return;
+    }
+
+    phase_ = (phase_ - 1.0) / attackInc_ * decayInc_;
+    state_ = State::Decay;
+
+    if (phase_ >= 1.0)
+    {
+        level_ = shape_.sustainLevel;
+        state_ = State::Sustain;
+    }
+    else if (phase_ > 0.0)
+    {
+        level_ = 1.0 + (shape_.sustainLevel - 1.0) * EnvelopeCurves::shape(shape_.decayCurve, phase_);
     }
 }
 
 float EnvelopeA::nextSample()
 {
-    static int counter = 0;
-    counter++;
+    float v = 0.0f;
+    renderBlock(&v, 1);
+    return v;
+}
 
-    if (state_ == State::Release && counter % 480 == 0)
+void EnvelopeA::renderBlock(float* out, int numSamples)
+{
+    ++debugCounter_;
+
+    if (state_ == State::Release && debugCounter_ % 480 == 0)
         DBG("EnvelopeA release level=" << level_);
 
-    switch (state_)
+    int i = 0;
+    while (i < numSamples)
     {
-        case State::Attack:
-            level_ += attackInc_;
-            if (level_ >= 1.0)
+        switch (state_)
+        {
+            case State::Attack:
+                for (; i < numSamples && state_ == State::Attack; ++i)
+                {
+                    phase_ += attackInc_;
+                    if (phase_ >= 1.0)
+                        endAttack();
+                    else
+                        level_ = EnvelopeCurves::shape(shape_.attackCurve, phase_);
+
+                    out[i] = static_cast<float>(level_);
+                }
+                break;
+
+            case State::Decay:
             {
-                level_ = 1.0;
-                state_ = State::Sustain;
+                const double drop = shape_.sustainLevel - 1.0;
+                for (; i < numSamples && state_ == State::Decay; ++i)
+                {
+                    phase_ += decayInc_;
+                    if (phase_ >= 1.0)
+                    {
+                        level_ = shape_.sustainLevel;
+                        state_ = State::Sustain;
+                    }
+                    else
+                    {
+                        level_ = 1.0 + drop * EnvelopeCurves::shape(shape_.decayCurve, phase_);
+                    }
+
+                    out[i] = static_cast<float>(level_);
+                }
+                break;
             }
-            break;
-
-        case State::Sustain:
-            // sustain holds level
-            break;
-
-        case State::Release:
-        {
-            ++releaseSamples_;
-            level_ *= releaseCoef_;
 
-            const uint64_t releaseSamplesTarget =
-                static_cast<uint64_t>(releaseSeconds_ * sampleRate_);
+            case State::Sustain:
+                level_ = shape_.sustainLevel;
+                std::fill(out + i, out + numSamples, static_cast<float>(level_));
+                i = numSamples;
+                break;
 
-            if (level_ <= 1e-5 || releaseSamples_ >= releaseSamplesTarget)
+            case State::Release:
             {
-                level_ = 0.0;
-                state_ = State::Idle;
-                DBG("EnvelopeA finished, level=" << level_);
+                // The tail ends at releaseEndSample_; run exactly up to it.
+                const uint64_t left = releaseEndSample_ - releaseSamples_;
+                const int run = static_cast<int>(std::min<uint64_t>(left, static_cast<uint64_t>(numSamples - i)));
+
+                for (int k = 0; k < run; ++k)
+                {
+                    level_ *= releaseCoef_;
+                    out[i + k] = static_cast<float>(level_);
+                }
+                releaseSamples_ += static_cast<uint64_t>(run);
+                i += run;
+
+                if (releaseSamples_ >= releaseEndSample_)
+                {
+                    level_ = 0.0;
+                    if (run > 0)
+                        out[i - 1] = 0.0f;
+                    state_ = State::Idle;
+                    DBG("EnvelopeA finished, level=" << level_);
+                }
+                break;
             }
-            break;
-        }
 
-        case State::Idle:
-        default:
-            break;
+            case State::Idle:
+            default:
+                std::fill(out + i, out + numSamples, static_cast<float>(level_));
+                i = numSamples;
+                break;
+        }
     }
-
-    return static_cast<float>(level_);
 }
 
 bool EnvelopeA::isActive() const
@@ -100,3 +230,13 @@ bool EnvelopeA::isActive() const
         DBG("EnvelopeA now Idle");
     return state_ != State::Idle;
 }
+
+uint64_t EnvelopeA::samplesUntilIdle() const noexcept
+{
+    switch (state_)
+    {
+        case State::Idle:    return 0;
+        case State::Release: return releaseEndSample_ - releaseSamples_;
+        default:             return unbounded;
+    }
+}
@@ -1,17 +1,44 @@
 #pragma once
+#include "EnvelopeADSR.h"
 #include <algorithm>
+#include <cstdint>
+#include <limits>
+
+// ============================================================
+// EnvelopeA — stateful ADSR on the shared AdsrShape
+// ------------------------------------------------------------
+// Attack and decay advance a per-sample segment phase (the shape's
+// reciprocal duration in samples) through the shape's curves;
+// release is geometric down to a floor, with its last sample fixed
+// at noteOff (not AdsrShape::releaseLevelAt(); see EnvelopeADSR.h). renderBlock() dispatches the stage once per segment;
+// nextSample() is a one-sample block, so both paths are identical.
+//
+// Defaults are attack → full level, no decay, sustain 1 (the
+// original attack/sustain/release envelope).
+// ============================================================
 
 class EnvelopeA {
 public:
     void prepare(double sampleRate);
     void setAttack(float seconds);
+    void setDecay(float seconds);
+    void setSustain(float level);
     void setRelease(float seconds);
+    void setCurves(EnvelopeCurve attack, EnvelopeCurve decay);
 
     void noteOn();
     void noteOff();
 
-    float nextSample();               // amplitude for next sample
-    bool  isActive() const;           // false once fully released
+    float nextSample();                         // amplitude for next sample
+    void  renderBlock(float* out, int numSamples);
+    bool  isActive() const;                     // false once fully released
+
+    // Samples left before the envelope goes Idle. The release end is
+    // fixed at noteOff (and when the release time changes mid-tail),
+    // so a voice can retire at an exact index instead of polling its
+    // output level. `unbounded` until the note is released.
+    static constexpr uint64_t unbounded = std::numeric_limits<uint64_t>::max();
+    uint64_t samplesUntilIdle() const noexcept;
 
     // ============================================================
     // Diagnostics / read-only accessors
@@ -20,16 +47,29 @@ public:
     double getAttackInc()    const noexcept { return attackInc_; }
     double getReleaseCoef()  const noexcept { return releaseCoef_; }
     double getReleaseSec()   const noexcept { return releaseSeconds_; }
+    const AdsrShape& getShape() const noexcept { return shape_; }
 
 private:
-    enum class State { Idle, Attack, Sustain, Release };
+    void computeReleaseEnd();
+    void computeIncrements();
+    void endAttack();
+
+    enum class State { Idle, Attack, Decay, Sustain, Release };
     State  state_ = State::Idle;
     double sampleRate_ = 44100.0;
     double level_ = 0.0;
-    double attackInc_ = 0.0;
+    double phase_ = 0.0;         // progress through attack / decay, 0 … 1
+    double attackInc_ = 0.0;     // phase per sample
+    double decayInc_ = 0.0;      // phase per sample (0: no decay)
     double releaseCoef_ = 0.0;   // multiplicative decay per-sample
 
+    AdsrShape shape_ { 0.01, 0.0, 1.0, 0.2 };
+
     double releaseStartLevel_ = 0.0;
     uint64_t releaseSamples_ = 0;
+    uint64_t releaseEndSample_ = 0;   // release sample index at which the tail ends
     double releaseSeconds_ = 0.2;     // store user-set release time
+
+    // Per-instance so voices rendering on different threads don't share it
+    int debugCounter_ = 0;
 };
@@ -0,0 +1,340 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+// ============================================================
+// EnvelopeADSR — the shared ADSR description and its analytic form
+// ------------------------------------------------------------
+// AdsrShape holds the segment times, sustain level and curve shapes
+// together with everything derived from them (segment ends and
+// reciprocal durations), so no evaluation divides. Two engines read
+// it:
+//
+//   EnvelopeA    — stateful, rendered a block at a time (VoiceA)
+//   AdsrTimeline — stateless, evaluated at arbitrary times
+//                  (VoiceDopp's retarded-time lookup)
+//
+// Attack, decay and sustain are the same in both. The release is
+// not: AdsrTimeline follows releaseLevelAt() (releaseCurve over
+// releaseSec), while EnvelopeA keeps VoiceA's original geometric
+// tail, start · 10^(−5 · t / releaseSec), cut to 0 at releaseSec or
+// on reaching 1e-5, whichever is first. That keeps VoiceA
+// bit-identical to the envelope it replaced; releaseCurve has no
+// effect on EnvelopeA. Both start from the held level at note-off
+// and are silent by releaseSec.
+//
+// Curves map segment progress u ∈ [0, 1] to travel ∈ [0, 1]:
+//
+//   Linear   u
+//   Convex   fast start, slow finish   (1 − e^{−ku}) / (1 − e^{−k})
+//   Concave  slow start, fast finish   1 − Convex(1 − u)
+//
+// Linear is evaluated directly; the others interpolate one shared
+// table, so every shape costs the same.
+// ============================================================
+
+enum class EnvelopeCurve : uint8_t
+{
+    Linear,
+    Convex,
+    Concave,
+};
+
+namespace EnvelopeCurves
+{
+    inline constexpr int    tableSize = 256;   // intervals
+    inline constexpr double steepness = 5.0;   // k
+
+    using Table = std::array<double, tableSize + 2>;   // + guard for u == 1
+
+    inline const Table& convexTable()
+    {
+        static const Table table = []
+        {
+            Table t {};
+            const double norm = 1.0 / (1.0 - std::exp(-steepness));
+            for (int i = 0; i <= tableSize; ++i)
+            {
+                const double u = static_cast<double>(i) / tableSize;
+                t[static_cast<size_t>(i)] = (1.0 - std::exp(-steepness * u)) * norm;
+            }
+            t[tableSize + 1] = t[tableSize];
+            return t;
+        }();
+        return table;
+    }
+
+    inline double convex(double u) noexcept
+    {
+        const auto& t = convexTable();
+        const double x = std::clamp(u, 0.0, 1.0) * tableSize;
+        const int    i = static_cast<int>(x);
+        const double f = x - i;
+        const double a = t[static_cast<size_t>(i)];
+        return a + (t[static_cast<size_t>(i) + 1] - a) * f;
+    }
+
+    inline double shape(EnvelopeCurve curve, double u) noexcept
+    {
+        switch (curve)
+        {
+            case EnvelopeCurve::Convex:  return convex(u);
+            case EnvelopeCurve::Concave: return 1.0 - convex(1.0 - u);
+            case EnvelopeCurve::Linear:
+            default:                     return u;
+        }
+    }
+}
+
+// ============================================================
+// AdsrShape — segment times, sustain, curves (+ derived values)
+// ============================================================
+struct AdsrShape
+{
+    double attackSec    = 0.01;
+    double decaySec     = 0.1;
+    double sustainLevel = 0.7;
+    double releaseSec   = 0.2;
+
+    EnvelopeCurve attackCurve  = EnvelopeCurve::Linear;
+    EnvelopeCurve decayCurve   = EnvelopeCurve::Linear;
+    EnvelopeCurve releaseCurve = EnvelopeCurve::Linear;
+
+    // Derived by update(); 0 reciprocal = segment absent.
+    double attackEnd  = 0.01;
+    double decayEnd   = 0.11;
+    double invAttack  = 100.0;
+    double invDecay   = 10.0;
+    double invRelease = 5.0;
+
+    void set(double attack, double decay, double sustain, double release) noexcept
+    {
+        attackSec    = attack;
+        decaySec     = decay;
+        sustainLevel = sustain;
+        releaseSec   = release;
+        update();
+    }
+
+    void update() noexcept
+    {
+        attackEnd  = attackSec;
+        decayEnd   = attackSec + decaySec;
+        invAttack  = attackSec  > 0.0 ? 1.0 / attackSec  : 0.0;
+        invDecay   = decaySec   > 0.0 ? 1.0 / decaySec   : 0.0;
+        invRelease = releaseSec > 0.0 ? 1.0 / releaseSec : 0.0;
+    }
+
+    // Level `t` seconds after note-on with the key still held (t > 0).
+    double heldLevelAt(double t) const noexcept
+    {
+        if (invAttack > 0.0 && t < attackEnd)
+            return EnvelopeCurves::shape(attackCurve, t * invAttack);
+
+        if (invDecay > 0.0 && t < decayEnd)
+            return 1.0 + (sustainLevel - 1.0) * EnvelopeCurves::shape(decayCurve, (t - attackEnd) * invDecay);
+
+        return sustainLevel;
+    }
+
+    // Level `tRel` seconds into a release that started at `startLevel`
+    // (0 ≤ tRel < releaseSec). AdsrTimeline only; EnvelopeA's release
+    // is geometric (see above).
+    double releaseLevelAt(double startLevel, double tRel) const noexcept
+    {
+        const double env = startLevel * (1.0 - EnvelopeCurves::shape(releaseCurve, tRel * invRelease));
+        return env < 0.0 ? 0.0 : env;
+    }
+};
+
+// ============================================================
+// AdsrTimeline — stateless evaluation at absolute times
+// ------------------------------------------------------------
+// valueAt(t) is a pure function of t once the shape and the note-on /
+// note-off times are set. The release start (relative to note-on)
+// and the level it releases from are computed when those change,
+// not per evaluation.
+//
+// The same changes also lay the envelope out as a timeline of
+// segments (before note-on, attack, decay, sustain, release, after),
+// each with its end and, for linear segments, an affine form
+// base + slope · (t − origin). A Cursor walks that timeline: for
+// non-decreasing times it stays in (or steps forward from) the
+// current segment, so a sample costs a compare and a multiply-add.
+// A time earlier than the previous one, or a timeline change,
+// restarts the walk from the first segment.
+// ============================================================
+class AdsrTimeline {
+public:
+    static constexpr double never = std::numeric_limits<double>::infinity();
+
+    struct Segment
+    {
+        double limit  = never;    // note-relative; the segment holds t < limit
+        double origin = 0.0;
+        double base   = 0.0;
+        double slope  = 0.0;
+        double floor  = -never;   // release clamps at 0
+        bool   curved = false;    // evaluate through the shape instead
+    };
+
+    static constexpr int maxSegments = 6;
+
+    class Cursor {
+    public:
+        double valueAt(const AdsrTimeline& tl, double tAbs) noexcept
+        {
+            const double t = tAbs - tl.noteOnSec_;
+
+            if (t >= seg_.limit || t < lastT_ || revision_ != tl.revision_)
+                seek(tl, t);
+            lastT_ = t;
+
+            if (seg_.curved)
+                return tl.valueAt(tAbs);
+
+            return std::max(seg_.floor, seg_.base + seg_.slope * (t - seg_.origin));
+        }
+
+        int getSegment() const noexcept { return index_; }
+
+    private:
+        void seek(const AdsrTimeline& tl, double t) noexcept
+        {
+            if (t < lastT_ || revision_ != tl.revision_)
+            {
+                index_    = 0;
+                revision_ = tl.revision_;
+            }
+
+            while (index_ < maxSegments - 1 && t >= tl.segments_[static_cast<size_t>(index_)].limit)
+                ++index_;
+
+            seg_ = tl.segments_[static_cast<size_t>(index_)];
+        }
+
+        Segment  seg_ { -never };   // forces a seek on first use
+        int      index_    = 0;
+        double   lastT_    = -never;
+        uint32_t revision_ = 0;
+    };
+
+    AdsrTimeline() { shape_.update(); update(); }
+
+    void setShape(const AdsrShape& s) noexcept { shape_ = s; shape_.update(); update(); }
+
+    void setADSR(double attack, double decay, double sustain, double release) noexcept
+    {
+        shape_.set(attack, decay, sustain, release);
+        update();
+    }
+
+    void setAttack(double seconds) noexcept  { setADSR(seconds, shape_.decaySec, shape_.sustainLevel, shape_.releaseSec); }
+    void setRelease(double seconds) noexcept { setADSR(shape_.attackSec, shape_.decaySec, shape_.sustainLevel, seconds); }
+
+    // noteOff = never while the key is held.
+    void setNoteTimes(double noteOn, double noteOff) noexcept
+    {
+        noteOnSec_  = noteOn;
+        noteOffSec_ = noteOff;
+        update();
+    }
+
+    const AdsrShape& shape() const noexcept { return shape_; }
+    double getNoteOnTime() const noexcept   { return noteOnSec_; }
+    double getNoteOffTime() const noexcept  { return noteOffSec_; }
+
+    // Release start relative to note-on (never if not released).
+    double getReleaseStart() const noexcept      { return releaseStart_; }
+    double getReleaseStartLevel() const noexcept { return releaseStartLevel_; }
+
+    double valueAt(double tAbs) const noexcept
+    {
+        const double t = tAbs - noteOnSec_;
+
+        if (t <= 0.0)
+            return 0.0;
+
+        if (t <= releaseStart_)
+            return shape_.heldLevelAt(t);
+
+        const double tRel = t - releaseStart_;
+        if (tRel >= shape_.releaseSec)
+            return 0.0;
+
+        return shape_.releaseLevelAt(releaseStartLevel_, tRel);
+    }
+
+private:
+    void update() noexcept
+    {
+        const bool hasRelease = std::isfinite(noteOffSec_) && shape_.releaseSec > 0.0;
+
+        releaseStart_      = hasRelease ? noteOffSec_ - noteOnSec_ : never;
+        releaseStartLevel_ = (hasRelease && releaseStart_ > 0.0) ? shape_.heldLevelAt(releaseStart_) : 0.0;
+
+        buildSegments();
+        ++revision_;
+    }
+
+    // Same precedence as valueAt(); a segment that cannot contain any
+    // time after the previous one is simply stepped over by the cursor.
+    // Inclusive ends (t <= end) become the next double up.
+    void buildSegments() noexcept
+    {
+        const double R = releaseStart_;
+        const auto& s  = shape_;
+
+        auto after = [](double end) { return std::nextafter(end, never); };
+
+        // Held segments end at their own end or at the release start,
+        // whichever comes first (the release start is inclusive).
+        auto heldLimit = [&](double end) { return R < end ? after(R) : end; };
+
+        Segment& before = segments_[0];
+        before = Segment {};
+        before.limit = after(0.0);
+
+        Segment& attack = segments_[1];
+        attack = Segment {};
+        attack.limit  = s.invAttack > 0.0 ? heldLimit(s.attackEnd) : -never;
+        attack.curved = s.attackCurve != EnvelopeCurve::Linear;
+        attack.slope  = s.invAttack;
+
+        Segment& decay = segments_[2];
+        decay = Segment {};
+        decay.limit  = s.invDecay > 0.0 ? heldLimit(s.decayEnd) : -never;
+        decay.curved = s.decayCurve != EnvelopeCurve::Linear;
+        decay.origin = s.attackEnd;
+        decay.base   = 1.0;
+        decay.slope  = (s.sustainLevel - 1.0) * s.invDecay;
+
+        Segment& sustain = segments_[3];
+        sustain = Segment {};
+        sustain.limit = after(R);
+        sustain.base  = s.sustainLevel;
+
+        Segment& release = segments_[4];
+        release = Segment {};
+        release.limit  = R + s.releaseSec;   // never when not released
+        release.curved = s.releaseCurve != EnvelopeCurve::Linear;
+        release.origin = R;
+        release.base   = releaseStartLevel_;
+        release.slope  = -releaseStartLevel_ * s.invRelease;
+        release.floor  = 0.0;
+
+        segments_[5] = Segment {};   // after the tail: 0 forever
+    }
+
+    AdsrShape shape_;
+    double noteOnSec_         = 0.0;
+    double noteOffSec_        = never;
+    double releaseStart_      = never;
+    double releaseStartLevel_ = 0.0;
+
+    std::array<Segment, maxSegments> segments_ {};
+    uint32_t revision_ = 1;   // a default Cursor (0) always rescans
+};
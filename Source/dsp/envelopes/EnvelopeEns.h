@@ -0,0 +1,161 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+// ============================================================
+// EnvelopeEns — bank of per-band envelopes (SoA)
+// ------------------------------------------------------------
+// Every band follows the same stage sequence, but with its own
+// peak level and decay time:
+//
+//   level[b] ← target[b] + (level[b] − target[b]) · coef[b]
+//
+// Stage changes (attack → decay → release) happen at chunk
+// boundaries in advance(); the per-sample update is a single
+// multiply-add per band, so it runs in the same SIMD lanes as the
+// filter bank (see FreqBandEns::processBlock).
+// ============================================================
+
+class EnvelopeEns {
+public:
+    static constexpr int maxBands = 64;
+
+    void prepare(double sampleRate)
+    {
+        sampleRate_ = sampleRate > 0.0 ? sampleRate : 44100.0;
+        reset();
+    }
+
+    void reset()
+    {
+        stage_ = Stage::Idle;
+        level_.fill(0.0f);
+        target_.fill(0.0f);
+        coef_.fill(0.0f);
+        stageSamples_ = 0;
+    }
+
+    void setAttack(float seconds)  { attackSec_  = std::max(0.0f, seconds); }
+    void setRelease(float seconds) { releaseSec_ = std::max(0.0f, seconds); }
+    void setSustain(float s)       { sustain_    = std::clamp(s, 0.0f, 1.0f); }
+
+    // Peak level and decay time for one band.
+    void setBand(int b, float peak, float decaySec)
+    {
+        if (b < 0 || b >= maxBands) return;
+        peak_[static_cast<size_t>(b)]     = peak;
+        decayCoef_[static_cast<size_t>(b)] = coefFor(decaySec);
+    }
+
+    void noteOn()
+    {
+        level_.fill(0.0f);
+        enter(Stage::Attack);
+    }
+
+    void noteOff()
+    {
+        if (stage_ != Stage::Idle)
+            enter(Stage::Release);
+    }
+
+    bool isActive() const noexcept { return stage_ != Stage::Idle; }
+
+    // Call once before rendering n samples.
+    void advance(int n, int numBands)
+    {
+        if (stage_ == Stage::Attack && stageSamples_ >= samplesFor(attackSec_))
+            enter(Stage::Decay);
+
+        if (stage_ == Stage::Release && stageSamples_ > 0)
+        {
+            float peak = 0.0f;
+            for (int b = 0; b < numBands; ++b)
+                peak = std::max(peak, std::fabs(level_[static_cast<size_t>(b)]));
+
+            if (peak < silenceLevel)
+            {
+                level_.fill(0.0f);
+                stage_ = Stage::Idle;
+            }
+        }
+
+        stageSamples_ += n;
+    }
+
+    float*       levels()        noexcept { return level_.data(); }
+    const float* levels()  const noexcept { return level_.data(); }
+    const float* targets() const noexcept { return target_.data(); }
+    const float* coefs()   const noexcept { return coef_.data(); }
+
+private:
+    enum class Stage { Idle, Attack, Decay, Release };
+
+    static constexpr float silenceLevel = 1e-5f;
+
+    // One-pole coefficient reaching ~99% of the way in `seconds`.
+    float coefFor(float seconds) const noexcept
+    {
+        if (seconds <= 0.0f)
+            return 0.0f;
+        return static_cast<float>(std::exp(-4.6 / (static_cast<double>(seconds) * sampleRate_)));
+    }
+
+    int samplesFor(float seconds) const noexcept
+    {
+        return static_cast<int>(static_cast<double>(seconds) * sampleRate_);
+    }
+
+    void enter(Stage s)
+    {
+        stage_ = s;
+        stageSamples_ = 0;
+
+        switch (s)
+        {
+            case Stage::Attack:
+            {
+                const float c = coefFor(attackSec_);
+                for (int b = 0; b < maxBands; ++b)
+                {
+                    target_[static_cast<size_t>(b)] = peak_[static_cast<size_t>(b)];
+                    coef_[static_cast<size_t>(b)]   = c;
+                }
+                break;
+            }
+            case Stage::Decay:
+                for (int b = 0; b < maxBands; ++b)
+                {
+                    target_[static_cast<size_t>(b)] = peak_[static_cast<size_t>(b)] * sustain_;
+                    coef_[static_cast<size_t>(b)]   = decayCoef_[static_cast<size_t>(b)];
+                }
+                break;
+
+            case Stage::Release:
+            {
+                const float c = coefFor(releaseSec_);
+                target_.fill(0.0f);
+                coef_.fill(c);
+                break;
+            }
+            case Stage::Idle:
+            default:
+                break;
+        }
+    }
+
+    Stage  stage_        = Stage::Idle;
+    double sampleRate_   = 44100.0;
+    int    stageSamples_ = 0;
+
+    float attackSec_  = 0.01f;
+    float releaseSec_ = 0.2f;
+    float sustain_    = 0.5f;
+
+    alignas(32) std::array<float, maxBands> level_     {};
+    alignas(32) std::array<float, maxBands> target_    {};
+    alignas(32) std::array<float, maxBands> coef_      {};
+    alignas(32) std::array<float, maxBands> peak_      {};
+    alignas(32) std::array<float, maxBands> decayCoef_ {};
+};
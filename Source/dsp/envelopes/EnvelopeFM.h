@@ -0,0 +1,163 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+
+// ============================================================
+// EnvelopeFM — per-operator ADSR, rendered a block at a time
+// ------------------------------------------------------------
+// The stage is dispatched once per segment rather than once per
+// sample: sustain/idle runs are plain fills and the ramps are tight
+// single-stage loops. nextSample() is a one-sample block, so the
+// per-sample and block paths are identical by construction.
+//
+//   Attack:  linear 0 → 1
+//   Decay:   exponential 1 → sustain
+//   Release: exponential level → 0
+// ============================================================
+
+class EnvelopeFM {
+public:
+    void prepare(double sampleRate)
+    {
+        sampleRate_ = sampleRate > 0.0 ? sampleRate : 44100.0;
+        stage_ = Stage::Idle;
+        level_ = 0.0f;
+        recompute();
+    }
+
+    void setADSR(float attackSec, float decaySec, float sustain, float releaseSec)
+    {
+        attackSec_  = std::max(0.0f, attackSec);
+        decaySec_   = std::max(0.0f, decaySec);
+        sustain_    = std::clamp(sustain, 0.0f, 1.0f);
+        releaseSec_ = std::max(0.0f, releaseSec);
+        recompute();
+    }
+
+    void setAttack(float seconds)  { setADSR(seconds, decaySec_, sustain_, releaseSec_); }
+    void setRelease(float seconds) { setADSR(attackSec_, decaySec_, sustain_, seconds); }
+
+    void noteOn()
+    {
+        stage_ = Stage::Attack;
+        level_ = 0.0f;
+    }
+
+    void noteOff()
+    {
+        if (stage_ != Stage::Idle)
+            stage_ = Stage::Release;
+    }
+
+    bool  isActive() const noexcept { return stage_ != Stage::Idle; }
+    float getLevel() const noexcept { return level_; }
+
+    float nextSample()
+    {
+        float v = 0.0f;
+        renderBlock(&v, 1);
+        return v;
+    }
+
+    // Writes numSamples envelope values to out.
+    void renderBlock(float* out, int numSamples)
+    {
+        int i = 0;
+        while (i < numSamples)
+        {
+            switch (stage_)
+            {
+                case Stage::Attack:
+                    for (; i < numSamples; ++i)
+                    {
+                        level_ += attackInc_;
+                        if (level_ >= 1.0f)
+                        {
+                            level_ = 1.0f;
+                            out[i++] = level_;
+                            stage_ = Stage::Decay;
+                            break;
+                        }
+                        out[i] = level_;
+                    }
+                    break;
+
+                case Stage::Decay:
+                    for (; i < numSamples; ++i)
+                    {
+                        level_ = sustain_ + (level_ - sustain_) * decayCoef_;
+                        if (level_ - sustain_ <= settleEps)
+                        {
+                            level_ = sustain_;
+                            out[i++] = level_;
+                            stage_ = Stage::Sustain;
+                            break;
+                        }
+                        out[i] = level_;
+                    }
+                    break;
+
+                case Stage::Sustain:
+                    std::fill(out + i, out + numSamples, level_);
+                    i = numSamples;
+                    break;
+
+                case Stage::Release:
+                    for (; i < numSamples; ++i)
+                    {
+                        level_ *= releaseCoef_;
+                        if (level_ <= settleEps)
+                        {
+                            level_ = 0.0f;
+                            out[i++] = level_;
+                            stage_ = Stage::Idle;
+                            break;
+                        }
+                        out[i] = level_;
+                    }
+                    break;
+
+                case Stage::Idle:
+                default:
+                    std::fill(out + i, out + numSamples, 0.0f);
+                    i = numSamples;
+                    break;
+            }
+        }
+    }
+
+private:
+    enum class Stage { Idle, Attack, Decay, Sustain, Release };
+
+    static constexpr float settleEps = 1e-5f;
+
+    // Per-sample coefficient that shrinks a distance by settleEps over `seconds`.
+    float expCoef(float seconds) const noexcept
+    {
+        if (seconds <= 0.0f)
+            return 0.0f;
+        return static_cast<float>(std::exp(std::log(1e-5) / (static_cast<double>(seconds) * sampleRate_)));
+    }
+
+    void recompute() noexcept
+    {
+        attackInc_   = (attackSec_ > 0.0f)
+                         ? static_cast<float>(1.0 / (static_cast<double>(attackSec_) * sampleRate_))
+                         : 1.0f;
+        decayCoef_   = expCoef(decaySec_);
+        releaseCoef_ = expCoef(releaseSec_);
+    }
+
+    Stage  stage_      = Stage::Idle;
+    double sampleRate_ = 44100.0;
+    float  level_      = 0.0f;
+
+    float attackSec_  = 0.01f;
+    float decaySec_   = 0.2f;
+    float sustain_    = 1.0f;
+    float releaseSec_ = 0.2f;
+
+    float attackInc_   = 0.0f;
+    float decayCoef_   = 0.0f;
+    float releaseCoef_ = 0.0f;
+};
@@ -0,0 +1,132 @@
+#pragma once
+#include "dsp/envelopes/EnvelopeEns.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+// ============================================================
+// FreqBandEns — bank of resonant band-pass SVFs (SoA, SIMD lanes)
+// ------------------------------------------------------------
+// Each band is a TPT state-variable filter (Simper form); the
+// band-pass output k·v1 has unit gain at the centre frequency.
+//
+// Layout: every coefficient and state lives in its own aligned
+// array of maxBands floats. processBlock() walks the bands in
+// groups of `lanes`; the fixed-width inner loop has no cross-lane
+// dependency, so it compiles to one SIMD op per line (4 bands per
+// SSE/NEON instruction, 8 per AVX). The output sum is kept as
+// `lanes` partial sums so no reassociation is needed.
+// ============================================================
+
+class FreqBandEns {
+public:
+    static constexpr int lanes    = 8;
+    static constexpr int maxBands = EnvelopeEns::maxBands;
+    static_assert(maxBands % lanes == 0, "band storage must be whole lane groups");
+
+    void prepare(double sampleRate)
+    {
+        sampleRate_ = sampleRate > 0.0 ? sampleRate : 44100.0;
+        reset();
+    }
+
+    void reset()
+    {
+        ic1_.fill(0.0f);
+        ic2_.fill(0.0f);
+    }
+
+    void setNumBands(int n)
+    {
+        numBands_  = std::clamp(n, 1, maxBands);
+        numGroups_ = (numBands_ + lanes - 1) / lanes;
+
+        // Padding lanes in the last group stay silent.
+        for (int b = numBands_; b < numGroups_ * lanes; ++b)
+            setBand(b, 1000.0, 1.0, 0.0f);
+    }
+
+    int getNumBands() const noexcept { return numBands_; }
+
+    // Bands above ~0.45·sr are muted rather than left to go unstable.
+    void setBand(int b, double centreHz, double q, float gain)
+    {
+        if (b < 0 || b >= maxBands) return;
+
+        const double maxHz = 0.45 * sampleRate_;
+        if (centreHz >= maxHz || centreHz <= 0.0)
+        {
+            gain = 0.0f;
+            centreHz = std::clamp(centreHz, 1.0, maxHz);
+        }
+
+        const double g  = std::tan(3.14159265358979323846 * centreHz / sampleRate_);
+        const double k  = 1.0 / std::max(q, 0.5);
+        const double a1 = 1.0 / (1.0 + g * (g + k));
+
+        const auto i = static_cast<size_t>(b);
+        a1_[i]  = static_cast<float>(a1);
+        a2_[i]  = static_cast<float>(g * a1);
+        a3_[i]  = static_cast<float>(g * g * a1);
+        out_[i] = static_cast<float>(k) * gain;
+    }
+
+    // out[n] += Σ_b env[b] · bp_b(in[n]); env is advanced in place.
+    void processBlock(const float* in, float* out, int numSamples, EnvelopeEns& env) noexcept
+    {
+        float*       lvl  = env.levels();
+        const float* tgt  = env.targets();
+        const float* coef = env.coefs();
+
+        float* ic1 = ic1_.data();
+        float* ic2 = ic2_.data();
+        const float* a1 = a1_.data();
+        const float* a2 = a2_.data();
+        const float* a3 = a3_.data();
+        const float* og = out_.data();
+
+        for (int n = 0; n < numSamples; ++n)
+        {
+            const float x = in[n];
+            alignas(32) float acc[lanes] = {};
+
+            for (int grp = 0; grp < numGroups_; ++grp)
+            {
+                const int base = grp * lanes;
+
+                for (int l = 0; l < lanes; ++l)
+                {
+                    const int b = base + l;
+
+                    const float v3 = x - ic2[b];
+                    const float v1 = a1[b] * ic1[b] + a2[b] * v3;
+                    const float v2 = ic2[b] + a2[b] * ic1[b] + a3[b] * v3;
+                    ic1[b] = 2.0f * v1 - ic1[b];
+                    ic2[b] = 2.0f * v2 - ic2[b];
+
+                    lvl[b] = tgt[b] + (lvl[b] - tgt[b]) * coef[b];
+                    acc[l] += v1 * og[b] * lvl[b];
+                }
+            }
+
+            float sum = 0.0f;
+            for (int l = 0; l < lanes; ++l)
+                sum += acc[l];
+
+            out[n] += sum;
+        }
+    }
+
+private:
+    double sampleRate_ = 44100.0;
+    int    numBands_   = 32;
+    int    numGroups_  = 4;
+
+    alignas(32) std::array<float, maxBands> ic1_ {};
+    alignas(32) std::array<float, maxBands> ic2_ {};
+    alignas(32) std::array<float, maxBands> a1_  {};
+    alignas(32) std::array<float, maxBands> a2_  {};
+    alignas(32) std::array<float, maxBands> a3_  {};
+    alignas(32) std::array<float, maxBands> out_ {};
+};
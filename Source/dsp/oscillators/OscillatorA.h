@@ -25,8 +25,8 @@ public:
         if (phase_ >= twoPi)
             phase_ -= twoPi; // wraparound
 
-        // safety clamp for denormals and near-zero bleed
-        return std::abs(value) < 1e-8 ? 0.0f : static_cast<float>(value);
+        // No denormal clamp here: render threads run with FTZ/DAZ set.
+        return static_cast<float>(value);
     }
 
 private:
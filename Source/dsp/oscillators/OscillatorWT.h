@@ -0,0 +1,138 @@
+#pragma once
+#include "dsp/oscillators/WavetableSet.h"
+#include "params/ParameterSnapshot.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+// ============================================================
+// OscillatorWT — band-limited wavetable oscillator
+// ------------------------------------------------------------
+// Reads the shared WavetableSet for its shape (no per-voice table
+// memory). Mip choice and crossfade weight are derived once per
+// setFrequency(), not per sample:
+//
+//   level = log2(tableSize·f/sr) + 1,  m = ⌊level⌋,  w = level − m
+//   out   = (1 − w)·row[m] + w·row[m+1]
+//
+// Row m's top harmonic stays below Nyquist over the whole octave,
+// and w → 1 at the octave edge, so the crossfade is continuous when
+// m steps up.
+//
+// Phase is a uint32 accumulator (2^32 = one cycle).
+// ============================================================
+
+class OscillatorWT {
+public:
+    enum class Interpolation { Linear, Cubic };
+
+    void prepare(double sampleRate)
+    {
+        sampleRate_ = sampleRate > 0.0 ? sampleRate : 44100.0;
+        phase_ = 0u;
+        updateIncrement();
+    }
+
+    void setShape(OscType shape)
+    {
+        table_ = &WavetableSet::get(shape);
+    }
+
+    OscType getShape() const noexcept { return table_->shape(); }
+
+    void setInterpolation(Interpolation i) noexcept { interp_ = i; }
+
+    void setFrequency(float hz)
+    {
+        freq_ = hz;
+        updateIncrement();
+    }
+
+    float getFrequency() const noexcept { return freq_; }
+
+    void resetPhase() { phase_ = 0u; }
+
+    int   getMipLevel() const noexcept     { return mip_; }
+    float getMipCrossfade() const noexcept { return mipFade_; }
+
+    float nextSample()
+    {
+        if (freq_ <= 0.0f)
+            return 0.0f;   // silence when frequency zeroed after release
+
+        const float* lo = table_->row(mip_);
+        const float* hi = table_->row(std::min(mip_ + 1, WavetableSet::numMips - 1));
+
+        const uint32_t idx  = phase_ >> fracBits;
+        const float    frac = static_cast<float>(phase_ & fracMask) * fracScale;
+
+        float a, b;
+        if (interp_ == Interpolation::Cubic)
+        {
+            a = cubic(lo, idx, frac);
+            b = cubic(hi, idx, frac);
+        }
+        else
+        {
+            a = lo[idx] + (lo[idx + 1] - lo[idx]) * frac;
+            b = hi[idx] + (hi[idx + 1] - hi[idx]) * frac;
+        }
+
+        phase_ += inc_;
+        return a + (b - a) * mipFade_;
+    }
+
+private:
+    static constexpr int      fracBits  = 32 - WavetableSet::tableBits;
+    static constexpr uint32_t fracMask  = (1u << fracBits) - 1u;
+    static constexpr float    fracScale = 1.0f / static_cast<float>(1u << fracBits);
+
+    // 4-point Hermite; row[−1] and row[N], row[N+1] are guard points.
+    static float cubic(const float* r, uint32_t i, float t) noexcept
+    {
+        const float xm1 = r[static_cast<int>(i) - 1];
+        const float x0  = r[i];
+        const float x1  = r[i + 1];
+        const float x2  = r[i + 2];
+
+        const float c1 = 0.5f * (x1 - xm1);
+        const float c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+        const float c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+        return ((c3 * t + c2) * t + c1) * t + x0;
+    }
+
+    void updateIncrement() noexcept
+    {
+        const double cycles = std::max(0.0, static_cast<double>(freq_)) / sampleRate_;
+        inc_ = static_cast<uint32_t>(std::min(cycles, 0.5) * 4294967296.0);
+
+        if (cycles <= 0.0)
+        {
+            mip_ = 0;
+            mipFade_ = 0.0f;
+            return;
+        }
+
+        const double level = std::log2(WavetableSet::tableSize * cycles) + 1.0;
+        const double top   = static_cast<double>(WavetableSet::numMips - 1);
+
+        if (level <= 0.0)      { mip_ = 0; mipFade_ = 0.0f; }
+        else if (level >= top) { mip_ = WavetableSet::numMips - 1; mipFade_ = 0.0f; }
+        else
+        {
+            mip_     = static_cast<int>(level);
+            mipFade_ = static_cast<float>(level - mip_);
+        }
+    }
+
+    const WavetableSet* table_ = &WavetableSet::get(OscType::Saw);
+    Interpolation interp_ = Interpolation::Cubic;
+
+    double   sampleRate_ = 44100.0;
+    float    freq_       = 440.0f;
+    uint32_t phase_      = 0u;
+    uint32_t inc_        = 0u;
+    int      mip_        = 0;
+    float    mipFade_    = 0.0f;
+};
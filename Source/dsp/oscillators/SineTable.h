@@ -0,0 +1,64 @@
+#pragma once
+#include "dsp/DspTables.h"
+
+#include <cmath>
+#include <cstdint>
+
+// ============================================================
+// SineTable — shared sine lookup for phase-accumulator voices
+// ------------------------------------------------------------
+// Phase is a full-range uint32 (2^32 == one cycle), so wrapping is
+// free and phase modulation is an integer add.
+//
+// size = 2048 points + one guard point, linear interpolation:
+// max error ≈ (2π/size)² / 8 ≈ 1.2e-6, well under float noise for
+// audio and far cheaper than std::sin per operator per sample.
+// The points live in the shared DspTables registry.
+// ============================================================
+
+class SineTable {
+public:
+    static constexpr int      bits = DspTables::sineBits;
+    static constexpr int      size = 1 << bits;   // 2048
+    static constexpr double   twoPi = 6.283185307179586476925286766559;
+    static constexpr double   cycle = 4294967296.0;   // 2^32
+
+    // sin(2π · phase / 2^32)
+    static float lookup(uint32_t phase) noexcept
+    {
+        constexpr int   fracBits  = 32 - bits;
+        constexpr float fracScale = 1.0f / static_cast<float>(1u << fracBits);
+
+        const float* t   = table();
+        const uint32_t i = phase >> fracBits;
+        const float frac = static_cast<float>(phase & ((1u << fracBits) - 1u)) * fracScale;
+
+        const float a = t[i];
+        const float b = t[i + 1];
+        return a + (b - a) * frac;
+    }
+
+    // Cycles per sample → phase increment.
+    static uint32_t incrementFor(double hz, double sampleRate) noexcept
+    {
+        if (sampleRate <= 0.0)
+            return 0u;
+
+        double cycles = hz / sampleRate;
+        cycles -= std::floor(cycles);
+        return static_cast<uint32_t>(cycles * cycle);
+    }
+
+    // Signed phase offset (radians) → phase units, wrapping.
+    static uint32_t radiansToPhase(float radians) noexcept
+    {
+        constexpr float scale = static_cast<float>(cycle / twoPi);
+        return static_cast<uint32_t>(static_cast<int64_t>(radians * scale));
+    }
+
+    // size + 1 points; the last one closes the cycle.
+    static const float* table() noexcept
+    {
+        return DspTables::get().sine();
+    }
+};
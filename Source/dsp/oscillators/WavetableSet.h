@@ -0,0 +1,73 @@
+#pragma once
+#include "dsp/DspTables.h"
+#include "params/ParameterSnapshot.h"
+
+#include <algorithm>
+#include <array>
+
+// ============================================================
+// WavetableSet — per-octave mipmapped, band-limited wavetables
+// ------------------------------------------------------------
+// A view of one shape's mips in the shared DspTables registry, so
+// 32 voices (and every plugin instance) read a single copy.
+//
+// Mip m holds harmonics 1 … tableSize/2 >> m, i.e. one octave less
+// bandwidth per level; mip numMips−1 is the bare fundamental.
+// Each mip row is 64-byte aligned and padded with guard points
+// (1 before, 2 after) so linear and 4-point cubic reads never wrap.
+//
+// Memory: numMips × rowStride × 4 bytes ≈ 91 KB per shape.
+// ============================================================
+
+class WavetableSet {
+public:
+    static constexpr int tableBits = DspTables::wtBits;
+    static constexpr int tableSize = DspTables::wtSize;       // 2048
+    static constexpr int numMips   = DspTables::wtMips;       // 1024 … 1 harmonics
+    static constexpr int guardPre  = DspTables::wtGuardPre;
+    static constexpr int guardPost = DspTables::wtGuardPost;
+    static constexpr int rowStride = DspTables::wtRowStride;  // 64-byte rows
+
+    static constexpr int numShapes = DspTables::wtShapes;
+
+    // Highest harmonic stored in mip m.
+    static constexpr int maxHarmonic(int mip) noexcept
+    {
+        return (tableSize / 2) >> mip;
+    }
+
+    // Row m, offset so that row(m)[0 … tableSize−1] is one cycle.
+    const float* row(int mip) const noexcept
+    {
+        return rows_[static_cast<size_t>(mip)];
+    }
+
+    OscType shape() const noexcept { return shape_; }
+
+    // Shared view for one shape.
+    static const WavetableSet& get(OscType shape)
+    {
+        static const std::array<WavetableSet, numShapes> sets = makeAll();
+        const int i = std::clamp(static_cast<int>(shape), 0, numShapes - 1);
+        return sets[static_cast<size_t>(i)];
+    }
+
+private:
+    static std::array<WavetableSet, numShapes> makeAll()
+    {
+        const auto& tables = DspTables::get();
+
+        std::array<WavetableSet, numShapes> sets;
+        for (int s = 0; s < numShapes; ++s)
+        {
+            auto& set  = sets[static_cast<size_t>(s)];
+            set.shape_ = static_cast<OscType>(s);
+            for (int m = 0; m < numMips; ++m)
+                set.rows_[static_cast<size_t>(m)] = tables.wavetableRow(set.shape_, m);
+        }
+        return sets;
+    }
+
+    OscType shape_ = OscType::Sine;
+    std::array<const float*, numMips> rows_ {};
+};
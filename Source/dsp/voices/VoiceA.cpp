@@ -1,6 +1,5 @@
 #include "VoiceA.h"
 #include <cmath>
-#include <fstream>
 
 // ============================================================
 // VoiceA: MIDI-note baseline pitch + persistent CC detune
@@ -9,10 +8,12 @@
 void VoiceA::prepare(double sampleRate)
 {
     osc_.prepare(sampleRate);
+    wt_.prepare(sampleRate);
     env_.prepare(sampleRate);
+    expr_.prepare(sampleRate);
 }
 
-void VoiceA::noteOn(const ParameterSnapshot& snapshot, int midiNote, float /*velocity*/)
+void VoiceA::noteOn(const ParameterSnapshot& snapshot, int midiNote, float velocity)
 {
     // --- Baseline pitch from MIDI note (A4=69 -> 440 Hz)
     const float baseHz = midiNoteToHz(midiNote);
@@ -25,10 +26,24 @@ void VoiceA::noteOn(const ParameterSnapshot& snapshot, int midiNote, float /*vel
         << " detuneSemis=" << detuneSemis_
         << " => freqHz=" << freqHz);
 
-    osc_.setFrequency(freqHz);
+    // Velocity curve × key tracking, fixed for the life of the note
+    noteGain_ = DspTables::get().noteGain(snapshot.velCurve, velocity, midiNote, snapshot.keyTrackDb);
+
+    oscType_ = snapshot.oscType;
+    if (oscType_ != OscType::Sine)
+        wt_.setShape(oscType_);
+
+    // Expression starts neutral; VoiceManager pushes the channel's
+    // current state right after noteOn.
+    expr_.set(NoteExpression {}, true);
+    pressureGain_ = 1.0f;
+
+    noteHz_ = freqHz;
+    applyPitch();
     env_.setAttack(snapshot.envAttack);
     env_.setRelease(snapshot.envRelease);
     osc_.resetPhase();
+    wt_.resetPhase();
     env_.noteOn();
 
     active_ = true;
@@ -41,14 +56,33 @@ void VoiceA::noteOff()
     env_.noteOff();
 }
 
+void VoiceA::setExpression(const NoteExpression& expression, bool immediate)
+{
+    expr_.set(expression, immediate);
+}
+
+void VoiceA::applyPitch()
+{
+    setOscFrequency(noteHz_ * expr_.pitchRatio());
+}
+
 bool VoiceA::isActive() const { return active_; }
 int  VoiceA::getNote() const noexcept { return note_; }
 
 void VoiceA::render(float* buffer, int numSamples)
 {
+    samplesRendered_ = 0;
+
     if (!active_)
         return;
 
+    // Only the live part of the block is rendered: the envelope's end
+    // is known analytically, so the tail stops on its last sample.
+    const uint64_t remaining = env_.samplesUntilIdle();
+    const int live = remaining < static_cast<uint64_t>(numSamples)
+                         ? static_cast<int>(remaining)
+                         : numSamples;
+
     float blockPeak = 0.0f;
     float blockSumSq = 0.0f;
 
@@ -60,31 +94,61 @@ void VoiceA::render(float* buffer, int numSamples)
     const double relCoef     = env_.getReleaseCoef();
     const double relSec      = env_.getReleaseSec();
 
-    for (int i = 0; i < numSamples; ++i)
+    const bool useTable = (oscType_ != OscType::Sine);
+    float gain = noteGain_ * pressureGain_;
+
+    for (int start = 0; start < live;)
     {
-        const float envValue = env_.nextSample();
-        const float oscValue = osc_.nextSample();
-        const float sample   = oscValue * envValue;
+        // Expression (bend / pressure) is applied per chunk and only
+        // while it is changing; otherwise the whole block is one run.
+        int n = live - start;
+        if (expr_.needsUpdate())
+        {
+            n = std::min(n, expressionChunk);
+            expr_.advance(n);
+            applyPitch();
+            pressureGain_ = 1.0f + expr_.pressure();   // up to +6 dB
+            gain = noteGain_ * pressureGain_;
+        }
+
+        // Envelope a chunk at a time (stage dispatched per segment).
+        for (int c = start; c < start + n; c += envChunk)
+        {
+            const int m = std::min(envChunk, start + n - c);
+            env_.renderBlock(envBuf_.data(), m);
+
+            for (int k = 0; k < m; ++k)
+            {
+                const float envValue = envBuf_[static_cast<size_t>(k)];
+                const float oscValue = useTable ? wt_.nextSample() : osc_.nextSample();
+                const float sample   = oscValue * envValue * gain;
+
+                buffer[c + k] += sample;
+                blockPeak = std::max(blockPeak, std::fabs(sample));
+                blockSumSq += sample * sample;
+            }
 
-        buffer[i] += sample;
-        blockPeak = std::max(blockPeak, std::fabs(sample));
-        blockSumSq += sample * sample;
+            if (c + m == live)
+                envEnd = envBuf_[static_cast<size_t>(m - 1)];
+        }
 
-        if (i == numSamples - 1)
-            envEnd = envValue;
+        start += n;
     }
 
     level_ = blockPeak;
+    samplesRendered_ = live;
 
-    // voice auto-deactivate on tail end
-    if (!env_.isActive() || blockPeak < 1e-3f)
+    // Retire at the envelope's computed tail end, not on output level:
+    // EnvelopeA goes Idle on an exact sample index after noteOff.
+    if (!env_.isActive())
     {
         active_ = false;
-        osc_.setFrequency(0.0f);
+        setOscFrequency(0.0f);
         osc_.resetPhase();
+        wt_.resetPhase();
     }
 
-    const float rms = std::sqrt(blockSumSq / std::max(1, numSamples));
+    const float rms = std::sqrt(blockSumSq / std::max(1, live));
 
     DBG("[VoiceA@render] note=" << note_
         << " freqHz=" << freqAtBlock
@@ -94,18 +158,7 @@ void VoiceA::render(float* buffer, int numSamples)
         << " blockRMS=" << rms
         << " peak=" << blockPeak
         << " active=" << (active_ ? "Y" : "N"));
-
-    // optional file log
-    std::ofstream log("voice_debug.txt", std::ios::app);
-    log << "[VoiceA@render] note=" << note_
-        << " freqHz=" << freqAtBlock
-        << " env(start→end)=" << envStart << "→" << envEnd
-        << " atkInc=" << atkInc
-        << " relSec=" << relSec
-        << " blockRMS=" << rms
-        << " peak=" << blockPeak
-        << " active=" << (active_ ? "Y" : "N")
-        << "\n";
+    juce::ignoreUnused(freqAtBlock, envStart, envEnd, atkInc, relSec, rms);
 }
 
 void VoiceA::updateParams(const VoiceParams& vp)
@@ -121,10 +174,7 @@ float VoiceA::getCurrentLevel() const { return level_; }
 
 void VoiceA::handleController(int cc, float norm)
 {
-    // Throttle duplicate spam
-    static float lastAttack = -1.0f;
-    static float lastRelease = -1.0f;
-    static float lastHz = -1.0f;
+    // Throttle duplicate spam (per voice: no shared state across instances)
     constexpr float epsA = 0.005f;
     constexpr float epsR = 0.05f;
     constexpr float epsF = 2.0f; // report only if live-freq moves ~>2 Hz
@@ -133,21 +183,21 @@ void VoiceA::handleController(int cc, float norm)
     {
         case 3: // Attack (perceptual 1 ms → 2 s)
         {
-            const float attack = 0.001f * std::pow(2000.0f, norm);
+            const float attack = ControllerCurves::attackSeconds(norm);
             env_.setAttack(attack);
-            if (std::fabs(attack - lastAttack) > epsA) {
+            if (std::fabs(attack - lastLoggedAttack_) > epsA) {
                 DBG("[CC3] attack=" << attack);
-                lastAttack = attack;
+                lastLoggedAttack_ = attack;
             }
             break;
         }
         case 4: // Release (perceptual 20 ms → 5 s)
         {
-            const float release = 0.020f * std::pow(250.0f, norm);
+            const float release = ControllerCurves::releaseSeconds(norm);
             env_.setRelease(release);
-            if (std::fabs(release - lastRelease) > epsR) {
+            if (std::fabs(release - lastLoggedRelease_) > epsR) {
                 DBG("[CC4] release=" << release);
-                lastRelease = release;
+                lastLoggedRelease_ = release;
             }
             break;
         }
@@ -158,10 +208,11 @@ void VoiceA::handleController(int cc, float norm)
             // If currently active, update oscillator live (recompute from current note)
             if (active_ && note_ >= 0) {
                 const float hz = applyDetuneSemis(currentNoteBaseHz(), detuneSemis_);
-                osc_.setFrequency(hz);
-                if (std::fabs(hz - lastHz) > epsF) {
+                noteHz_ = hz;
+                applyPitch();
+                if (std::fabs(hz - lastLoggedHz_) > epsF) {
                     DBG("[CC5] detuneSemis=" << detuneSemis_ << " => oscFreq=" << hz);
-                    lastHz = hz;
+                    lastLoggedHz_ = hz;
                 }
             } else {
                 DBG("[CC5] detuneSemis=" << detuneSemis_);
@@ -1,9 +1,14 @@
 #pragma once
 #include <juce_core/juce_core.h>
 #include "dsp/BaseVoice.h"
+#include "dsp/ControllerRouting.h"
+#include "dsp/DspTables.h"
+#include "dsp/VoiceExpression.h"
 #include "dsp/oscillators/OscillatorA.h"
+#include "dsp/oscillators/OscillatorWT.h"
 #include "dsp/envelopes/EnvelopeA.h"
 #include "params/ParameterSnapshot.h"
+#include <array>
 
 // ============================================================
 // VoiceA declaration only — implementations live in VoiceA.cpp
@@ -19,34 +24,81 @@ public:
     void render(float* buffer, int numSamples) override;
     float getCurrentLevel() const override;
 
+    // Live portion of the last block: stops at the envelope's end.
+    int getSamplesRendered() const noexcept override { return samplesRendered_; }
+
+    // Samples until the voice retires (EnvelopeA::unbounded while held).
+    uint64_t getRemainingSamples() const noexcept { return active_ ? env_.samplesUntilIdle() : 0; }
+
     // Live parameter modulation (added in Step 7)
     void updateParams(const VoiceParams& vp);
 
     // Per-voice controller mapping (CC3–CC5)
     void handleController(int cc, float norm) override;
 
+    // MPE: bend → pitch, pressure → level (up to +6 dB). Timbre is
+    // smoothed but has no destination on the sine/wavetable path.
+    void setExpression(const NoteExpression& expression, bool immediate) override;
+    const VoiceExpression& getExpression() const noexcept { return expr_; }
+
     // Persistent detune API (VoiceManager sets this on CC5)
     void setDetuneSemis(float s) noexcept { detuneSemis_ = s; }
     float getDetuneSemis() const noexcept { return detuneSemis_; }
 
+    // Waveform of the sounding note (taken from the snapshot at noteOn)
+    OscType getOscType() const noexcept { return oscType_; }
+
+    // Velocity/key gain of the sounding note (DspTables::noteGain)
+    float getNoteGain() const noexcept { return noteGain_; }
+
 private:
     static inline float midiNoteToHz(int note) noexcept {
-        return 440.0f * std::pow(2.0f, (note - 69) / 12.0f);
+        return DspTables::get().noteToHz(note);
     }
     static inline float applyDetuneSemis(float hz, float semis) noexcept {
-        return hz * std::pow(2.0f, semis / 12.0f);
+        return hz * DspTables::get().exp2(semis / 12.0f);
     }
 
     float currentNoteBaseHz() const noexcept {
         return (note_ >= 0) ? midiNoteToHz(note_) : 440.0f;
     }
 
-    OscillatorA osc_;
-    EnvelopeA   env_;
+    // Expression re-derives pitch/gain at most once per this many samples.
+    static constexpr int expressionChunk = 32;
+
+    // Envelope values are rendered into envBuf_ this many at a time.
+    static constexpr int envChunk = 64;
+
+    // Oscillators follow noteHz_ (note × CC5 detune) × bend ratio
+    void applyPitch();
+
+    // Sine → OscillatorA (original path); other shapes → shared wavetables
+    void setOscFrequency(float hz)
+    {
+        osc_.setFrequency(hz);
+        wt_.setFrequency(hz);
+    }
+
+    OscillatorA  osc_;
+    OscillatorWT wt_;
+    EnvelopeA    env_;
+    std::array<float, envChunk> envBuf_ {};
+    OscType      oscType_ = OscType::Sine;
     bool  active_ = false;
     int   note_   = -1;
     float level_  = 0.0f;
+    int   samplesRendered_ = 0;
+    float noteGain_ = 1.0f;
+    float noteHz_   = 0.0f;
+
+    VoiceExpression expr_;
+    float pressureGain_ = 1.0f;
 
     // persistent semitone detune applied at noteOn and during live CC5 moves
     float detuneSemis_ = 0.0f;
+
+    // handleController() DBG throttle
+    float lastLoggedAttack_  = -1.0f;
+    float lastLoggedRelease_ = -1.0f;
+    float lastLoggedHz_      = -1.0f;
 };
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "dsp/BaseVoice.h"
+#include "dsp/DspTables.h"
+#include "dsp/HalfBandDecimator.h"
+#include "dsp/envelopes/EnvelopeADSR.h"
 #include "params/ParameterSnapshot.h"
 
 #include <cmath>
+#include <array>
 #include <atomic>
 #include <limits>  // for std::numeric_limits
 #include <vector>
@@ -22,6 +26,7 @@
 // Action 6: Distance + retarded time (pure math only)
 // Action 7: Source functions at retarded time (pure math only)
 // Action 8: Predictive Scoring (public DSP API)
+// Oversampling: optional 2x/4x anti-aliased render path
 // ============================================================
 
 class VoiceDopp : public BaseVoice
@@ -54,8 +59,7 @@ public:
         enableTimeAccumulation_ = false;
 
         // Action-7: reset envelope times to defaults
-        noteOnTimeSec_  = 0.0;
-        noteOffTimeSec_ = std::numeric_limits<double>::infinity();
+        adsr_.setNoteTimes(0.0, AdsrTimeline::never);
     }
 
     // ------------------------------------------------------------
@@ -65,7 +69,9 @@ public:
                 int midiNote,
                 float velocity) override
     {
-        (void)velocity;
+        // Velocity curve × key tracking, folded into the attenuation
+        // kernel so the render loops carry no extra per-sample term.
+        noteGain_ = DspTables::get().noteGain(snapshot.velCurve, velocity, midiNote, snapshot.keyTrackDb);
 
         // ============================================================
         // A10-1: baseFrequencyHz_
@@ -84,8 +90,8 @@ public:
         }
 
         // Envelope globals
-        adsrAttackSec_  = snapshot.envAttack;
-        adsrReleaseSec_ = snapshot.envRelease;
+        adsr_.setADSR(snapshot.envAttack, adsr_.shape().decaySec,
+                      adsr_.shape().sustainLevel, snapshot.envRelease);
 
         // ============================================================
         // Phase IV — CC sampling at note-on (Spec §1)
@@ -122,8 +128,10 @@ public:
         timeSec_     = 0.0;
 
         // For now ADSR timing stays mathematical (per your A7 spec):
-        noteOnTimeSec_  = 0.0;
-        noteOffTimeSec_ = std::numeric_limits<double>::infinity();
+        adsr_.setNoteTimes(0.0, AdsrTimeline::never);
+
+        // Decimator history belongs to the previous note.
+        activeOsFactor_ = 1;
     }
 
     // ------------------------------------------------------------
@@ -204,52 +212,55 @@ public:
         const int mMax =  latticeMRadius_;
 
         auto best = findBestEmitterInWindow(kMin, kMax, mMin, mMax);
-        auto emitterPos = best.position;
 
         // ============================================================
         // AUDIO-ONLY VELOCITY SCALING (does NOT affect tests)
         // ============================================================
-        static constexpr double dopplerSpeedScale_ = 5.0;   // YOU CAN TUNE THIS
         const double physicalSpeed = computeSpeed();         // unchanged math API
         const double scaledSpeed   = physicalSpeed * dopplerSpeedScale_;
 
         const auto uvec = computeUnitVector();
 
-        const double vx = scaledSpeed * static_cast<double>(uvec.x);
-        const double vy = scaledSpeed * static_cast<double>(uvec.y);
-
-        // ============================================================
-        // Synthesize per sample
-        // ============================================================
-        for (int i = 0; i < numSamples; ++i)
-        {
-            const double dt = (sr > 0.0) ? (static_cast<double>(i) / sr) : 0.0;
-            const double tSample = tStart + dt;
+        BlockGeometry g;
+        g.tStart     = tStart;
+        g.posStart   = posStart;
+        g.vx         = scaledSpeed * static_cast<double>(uvec.x);
+        g.vy         = scaledSpeed * static_cast<double>(uvec.y);
+        g.emitterPos = best.position;
 
-            const juce::Point<float> posSample {
-                posStart.x + static_cast<float>(vx * dt),
-                posStart.y + static_cast<float>(vy * dt)
-            };
+        renderAudibleBlock(buffer, numSamples, g, scaledSpeed);
+    }
 
-            // Distance r_i(t)
-            const double dx = static_cast<double>(emitterPos.x) - static_cast<double>(posSample.x);
-            const double dy = static_cast<double>(emitterPos.y) - static_cast<double>(posSample.y);
-            const double r  = std::sqrt(dx*dx + dy*dy);
+    // ------------------------------------------------------------
+    // Oversampled rendering (anti-aliasing)
+    // ------------------------------------------------------------
+    enum class OversamplingMode
+    {
+        Off,      // always 1x
+        Auto,     // 1x / 2x / 4x from the predicted top partial (default)
+        Force2x,
+        Force4x
+    };
 
-            // Retarded time t_ret = t - r/c
-            const double tRet = tSample - r / speedOfSound_;
+    void setOversamplingMode(OversamplingMode m) noexcept { oversamplingMode_ = m; }
+    OversamplingMode getOversamplingMode() const noexcept { return oversamplingMode_; }
 
-            // Source components at retarded time
-            const double carrier = evalCarrierAtRetardedTime(tRet);
-            const double env     = evalAdsrAtRetardedTime(tRet);
-            const double pulse   = evalFieldPulseAtRetardedTime(tRet);
+    // Fraction of the (1x or 2x) Nyquist frequency above which Auto
+    // steps up to the next factor.
+    void setOversamplingThreshold(double fractionOfNyquist) noexcept
+    {
+        oversamplingThreshold_ = juce::jlimit(0.1, 1.0, fractionOfNyquist);
+    }
 
-            // Simple attenuation kernel
-            const double atten = evalAttenuationKernel(r);
+    // Factor used by the most recent render() call.
+    int getOversamplingFactor() const noexcept { return activeOsFactor_; }
 
-            const double sample = carrier * env * pulse * atten;
-            buffer[i] += static_cast<float>(sample);
-        }
+    // Highest expected partial: carrier plus pulse sideband, scaled
+    // by the worst-case classical Doppler ratio 1 + |v|/c.
+    double predictTopPartialHz(double scaledSpeed) const noexcept
+    {
+        const double ratio = 1.0 + std::abs(scaledSpeed) / speedOfSound_;
+        return (std::abs(baseFrequencyHz_) + std::abs(fieldPulseHz_)) * ratio;
     }
 
     // ------------------------------------------------------------
@@ -499,16 +510,12 @@ public:
                               double sustainLevel,
                               double releaseSec)
     {
-        adsrAttackSec_     = attackSec;
-        adsrDecaySec_      = decaySec;
-        adsrSustainLevel_  = sustainLevel;
-        adsrReleaseSec_    = releaseSec;
+        adsr_.setADSR(attackSec, decaySec, sustainLevel, releaseSec);
     }
 
     void setAdsrTimesForTest(double tOn, double tOff)
     {
-        noteOnTimeSec_  = tOn;
-        noteOffTimeSec_ = tOff;
+        adsr_.setNoteTimes(tOn, tOff);
     }
 
     void setBaseFrequencyForTest(double freqHz)
@@ -533,76 +540,24 @@ public:
         return 0.5 * (1.0 + std::sin(phase));
     }
 
+    // Shared analytic ADSR (EnvelopeADSR.h): segment ends, reciprocal
+    // durations and the release start level are precomputed when the
+    // shape or note times change. Render paths use nextAdsrValue().
     double evalAdsrAtRetardedTime(double tRet) const
     {
-        double t = tRet - noteOnTimeSec_;
-
-        if (t <= 0.0)
-            return 0.0;
-
-        const double attack  = adsrAttackSec_;
-        const double decay   = adsrDecaySec_;
-        const double release = adsrReleaseSec_;
-        const double sustain = adsrSustainLevel_;
-
-        const double attackEnd = attack;
-        const double decayEnd  = attack + decay;
-
-        const bool hasRelease  =
-            std::isfinite(noteOffTimeSec_) && release > 0.0;
-
-        const double tReleaseStart =
-            hasRelease
-                ? (noteOffTimeSec_ - noteOnTimeSec_)
-                : std::numeric_limits<double>::infinity();
-
-        if (!hasRelease || t <= tReleaseStart)
-        {
-            if (attack > 0.0 && t < attackEnd)
-            {
-                return t / attack;
-            }
-
-            if (decay > 0.0 && t < decayEnd)
-            {
-                double u = (t - attackEnd) / decay;
-                return 1.0 + (sustain - 1.0) * u;
-            }
-
-            return sustain;
-        }
-
-        double tRel = t - tReleaseStart;
-        if (tRel >= release)
-            return 0.0;
-
-        double envAtReleaseStart = 0.0;
-
-        if (tReleaseStart <= 0.0)
-        {
-            envAtReleaseStart = 0.0;
-        }
-        else if (attack > 0.0 && tReleaseStart < attackEnd)
-        {
-            envAtReleaseStart = tReleaseStart / attack;
-        }
-        else if (decay > 0.0 && tReleaseStart < decayEnd)
-        {
-            double u = (tReleaseStart - attackEnd) / decay;
-            envAtReleaseStart = 1.0 + (sustain - 1.0) * u;
-        }
-        else
-        {
-            envAtReleaseStart = sustain;
-        }
+        return adsr_.valueAt(tRet);
+    }
 
-        double r = 1.0 - (tRel / release);
-        double env = envAtReleaseStart * r;
-        if (env < 0.0)
-            env = 0.0;
-        return env;
+    // Same values through the timeline cursor: for the monotone tRet
+    // of subsonic motion each sample stays in (or steps forward from)
+    // the current segment; a backward jump re-scans the timeline.
+    double nextAdsrValue(double tRet) noexcept
+    {
+        return adsrCursor_.valueAt(adsr_, tRet);
     }
 
+    const AdsrTimeline& getAdsrTimeline() const noexcept { return adsr_; }
+
     // ------------------------------------------------------------
     // ------------------------------------------------------------
     // **Action-8: Predictive Scoring (public DSP API)**
@@ -680,21 +635,26 @@ public:
         if (!pitchFromMidi_)
             baseFrequencyHz_ = vp.oscFreq;
 
-        adsrAttackSec_   = vp.envAttack;
-        adsrReleaseSec_  = vp.envRelease;
+        // Unchanged every block for a held note: keep the timeline
+        // (and the cursor's place in it).
+        if (adsr_.shape().attackSec == vp.envAttack && adsr_.shape().releaseSec == vp.envRelease)
+            return;
+
+        adsr_.setADSR(vp.envAttack, adsr_.shape().decaySec,
+                      adsr_.shape().sustainLevel, vp.envRelease);
     }
 
     // ------------------------------------------------------------
     // A10-1: minimal public getters for tests
     // ------------------------------------------------------------
     double getBaseFrequencyHzForTest() const noexcept  { return baseFrequencyHz_; }
-    double getAdsrAttackSecForTest() const noexcept    { return adsrAttackSec_; }
-    double getAdsrReleaseSecForTest() const noexcept   { return adsrReleaseSec_; }
+    double getAdsrAttackSecForTest() const noexcept    { return adsr_.shape().attackSec; }
+    double getAdsrReleaseSecForTest() const noexcept   { return adsr_.shape().releaseSec; }
 
     // === NEW for Action10.1 =========================================
     double getBaseFrequencyForTest() const noexcept { return baseFrequencyHz_; }
-    double getAttackForTest() const noexcept        { return adsrAttackSec_; }
-    double getReleaseForTest() const noexcept       { return adsrReleaseSec_; }
+    double getAttackForTest() const noexcept        { return adsr_.shape().attackSec; }
+    double getReleaseForTest() const noexcept       { return adsr_.shape().releaseSec; }
     
     // ------------------------------------------------------------
     // Action-9: Lattice window sampling + best-emitter selection
@@ -750,7 +710,10 @@ public:
         pitchFromMidi_ = b;
     }
 
-private:
+protected:
+    // State and helpers below are shared with derived voices built on
+    // the same field geometry (e.g. VoiceLET).
+
     // Phase III skeleton state
     double sampleRate_ = 48000.0;
     bool   active_     = false;
@@ -777,13 +740,11 @@ private:
     double basePhaseRad_      = 0.0;
     double fieldPulseHz_      = 1.0;
 
-    double adsrAttackSec_     = 0.01;
-    double adsrDecaySec_      = 0.1;
-    double adsrSustainLevel_  = 0.7;
-    double adsrReleaseSec_    = 0.2;
+    // A 0.01 / D 0.1 / S 0.7 / R 0.2, linear segments
+    AdsrTimeline adsr_;
+    AdsrTimeline::Cursor adsrCursor_;
 
-    double noteOnTimeSec_     = 0.0;
-    double noteOffTimeSec_    = std::numeric_limits<double>::infinity();
+    double noteGain_          = 1.0;   // velocity curve × key tracking
 
     // ------------------------------------------------------------
     // Phase IV CC cache for VoiceDopp (Spec §1)
@@ -811,13 +772,13 @@ private:
 
     // ------------------------------------------------------------
     // Action-10.5 local attenuation kernel
-    // w(r) = exp(-alpha r) / max(r, r_min)
+    // w(r) = g · exp(-alpha r) / max(r, r_min), g = note velocity/key gain
     // This is *audio-only* for now; predictive score integration is A10-4.
     // ------------------------------------------------------------
     double evalAttenuationKernel(double r) const noexcept
     {
         const double rSafe = (r < attenuationRMin_) ? attenuationRMin_ : r;
-        return std::exp(-attenuationAlpha_ * rSafe) / rSafe;
+        return noteGain_ * std::exp(-attenuationAlpha_ * rSafe) / rSafe;
     }
 
     // Map CC4 normalized [0,1] to a usable pulse frequency in Hz.
@@ -833,6 +794,168 @@ private:
         return std::exp(logLo + (logHi - logLo) * n);
     }
 
+    // ------------------------------------------------------------
+    // Per-block geometry shared by the 1x and oversampled paths
+    // ------------------------------------------------------------
+    struct BlockGeometry
+    {
+        double tStart = 0.0;
+        juce::Point<float> posStart {};
+        double vx = 0.0;
+        double vy = 0.0;
+        juce::Point<float> emitterPos {};
+    };
+
+    // ------------------------------------------------------------
+    // Audible synthesis for one block, after gating, time
+    // accumulation and emitter selection. Derived voices override
+    // this to change the propagation law; the default is classical
+    // Doppler with optional oversampling.
+    // ------------------------------------------------------------
+    virtual void renderAudibleBlock(float* buffer, int numSamples,
+                                    const BlockGeometry& g, double scaledSpeed)
+    {
+        // Anti-aliasing: oversample only when the predicted top
+        // partial would approach Nyquist.
+        const int factor = chooseOversamplingFactor(scaledSpeed);
+
+        if (factor > 1)
+        {
+            renderOversampled(buffer, numSamples, g, factor);
+            return;
+        }
+
+        activeOsFactor_ = 1;
+
+        // ============================================================
+        // Synthesize per sample
+        // ============================================================
+        const double sr = sampleRate_;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const double dt = (sr > 0.0) ? (static_cast<double>(i) / sr) : 0.0;
+            buffer[i] += static_cast<float>(evalSampleAt(g, dt));
+        }
+    }
+
+    // One output sample at block-relative time dt (seconds).
+    double evalSampleAt(const BlockGeometry& g, double dt) noexcept
+    {
+        const double tSample = g.tStart + dt;
+
+        const juce::Point<float> posSample {
+            g.posStart.x + static_cast<float>(g.vx * dt),
+            g.posStart.y + static_cast<float>(g.vy * dt)
+        };
+
+        // Distance r_i(t)
+        const double dx = static_cast<double>(g.emitterPos.x) - static_cast<double>(posSample.x);
+        const double dy = static_cast<double>(g.emitterPos.y) - static_cast<double>(posSample.y);
+        const double r  = std::sqrt(dx*dx + dy*dy);
+
+        // Retarded time t_ret = t - r/c
+        const double tRet = tSample - r / speedOfSound_;
+
+        // Source components at retarded time
+        const double carrier = evalCarrierAtRetardedTime(tRet);
+        const double env     = nextAdsrValue(tRet);
+        const double pulse   = evalFieldPulseAtRetardedTime(tRet);
+
+        // Simple attenuation kernel
+        const double atten = evalAttenuationKernel(r);
+
+        return carrier * env * pulse * atten;
+    }
+
+    int chooseOversamplingFactor(double scaledSpeed) const noexcept
+    {
+        switch (oversamplingMode_)
+        {
+            case OversamplingMode::Off:     return 1;
+            case OversamplingMode::Force2x: return 2;
+            case OversamplingMode::Force4x: return 4;
+            case OversamplingMode::Auto:
+            default: break;
+        }
+
+        const double nyquist = 0.5 * sampleRate_;
+        const double fTop    = predictTopPartialHz(scaledSpeed);
+
+        // Step down only once clearly below a level (hysteresis),
+        // so a partial hovering at the threshold doesn't toggle.
+        const double down2 = (activeOsFactor_ >= 2) ? oversamplingHysteresis_ : 1.0;
+        const double down4 = (activeOsFactor_ >= 4) ? oversamplingHysteresis_ : 1.0;
+
+        if (fTop > oversamplingThreshold_ * 2.0 * nyquist * down4) return 4;
+        if (fTop > oversamplingThreshold_ * nyquist * down2)       return 2;
+        return 1;
+    }
+
+    // Decimation delay in seconds for a given factor; the kernel is
+    // evaluated this far ahead so the output stays time-aligned
+    // with the 1x path.
+    double oversamplingDelaySeconds(int factor) const noexcept
+    {
+        const double d = static_cast<double>(HalfBandDecimator::groupDelayInputSamples);
+        return (factor == 4) ? d / (4.0 * sampleRate_) + d / (2.0 * sampleRate_)
+                             : d / (2.0 * sampleRate_);
+    }
+
+    // Render numOut output samples starting at output index firstOut
+    // (may be negative when priming) through the decimator chain.
+    // dest may be null (priming: results discarded).
+    void renderOversampledChunk(const BlockGeometry& g, int factor,
+                                int firstOut, int numOut, float* dest) noexcept
+    {
+        const double osRate = sampleRate_ * static_cast<double>(factor);
+        const double delay  = oversamplingDelaySeconds(factor);
+        const int    numOs  = numOut * factor;
+        const int    firstOs = firstOut * factor;
+
+        for (int j = 0; j < numOs; ++j)
+        {
+            const double dt = static_cast<double>(firstOs + j) / osRate + delay;
+            osScratch_[static_cast<size_t>(j)] = static_cast<float>(evalSampleAt(g, dt));
+        }
+
+        float* out = decimOut_.data();
+
+        if (factor == 4)
+        {
+            decim4to2_.process(osScratch_.data(), osMid_.data(), numOut * 2);
+            decim2to1_.process(osMid_.data(), out, numOut);
+        }
+        else
+        {
+            decim2to1_.process(osScratch_.data(), out, numOut);
+        }
+
+        if (dest != nullptr)
+            for (int i = 0; i < numOut; ++i)
+                dest[i] += out[i];
+    }
+
+    void renderOversampled(float* buffer, int numSamples, const BlockGeometry& g, int factor) noexcept
+    {
+        // On entering (or changing) oversampling, prime the decimators
+        // with the signal just before this block. The kernel is an
+        // analytic function of time, so this is exact and switching
+        // factors mid-note is seamless.
+        if (factor != activeOsFactor_)
+        {
+            decim4to2_.reset();
+            decim2to1_.reset();
+            renderOversampledChunk(g, factor, -osPrimeOutputs_, osPrimeOutputs_, nullptr);
+            activeOsFactor_ = factor;
+        }
+
+        for (int start = 0; start < numSamples; start += osChunkOutputs_)
+        {
+            const int len = std::min(osChunkOutputs_, numSamples - start);
+            renderOversampledChunk(g, factor, start, len, buffer + start);
+        }
+    }
+
     // Small default lattice window for audio (tune later)
     static constexpr int latticeKRadius_ = 2;
     static constexpr int latticeMRadius_ = 4;
@@ -843,4 +966,23 @@ private:
     bool audioEnabled_ = false;
 
     bool pitchFromMidi_ = false;
+
+    // ------------------------------------------------------------
+    // Oversampling state (preallocated; chunked so no per-block
+    // allocation regardless of host block size)
+    // ------------------------------------------------------------
+    static constexpr double dopplerSpeedScale_     = 5.0;   // audio-only velocity scaling
+    static constexpr double oversamplingHysteresis_ = 0.9;
+    static constexpr int    osChunkOutputs_        = 32;
+    static constexpr int    osPrimeOutputs_        = HalfBandDecimator::numTaps;
+
+    OversamplingMode oversamplingMode_ = OversamplingMode::Auto;
+    double oversamplingThreshold_      = 0.9;
+    int    activeOsFactor_             = 1;
+
+    HalfBandDecimator decim4to2_;
+    HalfBandDecimator decim2to1_;
+    std::array<float, 4 * osPrimeOutputs_> osScratch_ {};
+    std::array<float, 2 * osPrimeOutputs_> osMid_     {};
+    std::array<float, osPrimeOutputs_>     decimOut_  {};
 };
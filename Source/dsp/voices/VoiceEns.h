@@ -0,0 +1,237 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "dsp/BaseVoice.h"
+#include "dsp/ControllerRouting.h"
+#include "dsp/DspTables.h"
+#include "dsp/envelopes/EnvelopeEns.h"
+#include "dsp/filters/FreqBandEns.h"
+#include "params/ParameterSnapshot.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+// ============================================================
+// VoiceEns — ensemble of resonant frequency bands
+// ------------------------------------------------------------
+// Roadmap §3 (VoiceEns / FreqBandEns / EnvelopeEns):
+//   excitation (white noise) → FreqBandEns (16–64 band-pass SVFs
+//   centred on the note's partials) → per-band EnvelopeEns → sum
+//
+// Band b sits at f0·(b+1)·(1 + spread·b), with a 1/(b+1)^tilt
+// level and a decay that shortens for higher bands.
+//
+// CC3/CC4 attack/release (VoiceA curves), CC6 spread,
+// CC7 resonance (Q), CC8 spectral tilt.
+// ============================================================
+
+class VoiceEns : public BaseVoice {
+public:
+    static constexpr int minBands     = 16;
+    static constexpr int maxBands     = FreqBandEns::maxBands;
+    static constexpr int defaultBands = 32;
+    static constexpr int maxChunk     = 64;
+
+    // ------------------------------------------------------------
+    // Polyphony budget
+    // From Tests/bench/test_bench_voice_cost.cpp ("[bench]"):
+    // ~1 ns per band per sample in optimised builds, ~4.5 ns at -O1.
+    // bandBudget bands of concurrent voices cost ≤ ~2.3 µs per sample
+    // even unoptimised, ~11% of one core at 48 kHz, before the
+    // render pool spreads voices over worker threads.
+    // ------------------------------------------------------------
+    static constexpr int bandBudget = 512;
+
+    static constexpr int polyphonyLimit(int numBands) noexcept
+    {
+        const int n = numBands < 1 ? 1 : numBands;
+        const int v = bandBudget / n;
+        return v < 1 ? 1 : v;
+    }
+
+    // ------------------------------------------------------------
+    // BaseVoice
+    // ------------------------------------------------------------
+    void prepare(double sampleRate) override
+    {
+        sampleRate_ = sampleRate > 0.0 ? sampleRate : 44100.0;
+
+        bank_.prepare(sampleRate_);
+        bank_.setNumBands(numBands_);
+        env_.prepare(sampleRate_);
+
+        active_ = false;
+        note_   = -1;
+        level_  = 0.0f;
+    }
+
+    void noteOn(const ParameterSnapshot& snapshot, int midiNote, float /*velocity*/) override
+    {
+        baseHz_ = DspTables::get().noteToHz(midiNote);
+
+        env_.setAttack(snapshot.envAttack);
+        env_.setRelease(snapshot.envRelease);
+
+        bank_.reset();
+        configureBands();
+        env_.noteOn();
+
+        DBG("VoiceEns::noteOn midiNote=" << midiNote
+            << " baseHz=" << baseHz_
+            << " bands=" << numBands_);
+
+        active_ = true;
+        note_   = midiNote;
+        level_  = 0.0f;
+    }
+
+    void noteOff() override
+    {
+        env_.noteOff();
+    }
+
+    bool  isActive() const override          { return active_; }
+    int   getNote() const noexcept override  { return note_; }
+    float getCurrentLevel() const override   { return level_; }
+
+    void render(float* buffer, int numSamples) override
+    {
+        if (!active_)
+            return;
+
+        float blockPeak = 0.0f;
+
+        for (int start = 0; start < numSamples && active_; start += maxChunk)
+        {
+            const int n = std::min(maxChunk, numSamples - start);
+
+            env_.advance(n, numBands_);
+            if (!env_.isActive())
+            {
+                active_ = false;
+                break;
+            }
+
+            for (int i = 0; i < n; ++i)
+                noise_[static_cast<size_t>(i)] = nextNoise();
+
+            std::fill(chunk_.begin(), chunk_.begin() + n, 0.0f);
+            bank_.processBlock(noise_.data(), chunk_.data(), n, env_);
+
+            for (int i = 0; i < n; ++i)
+            {
+                buffer[start + i] += chunk_[static_cast<size_t>(i)];
+                blockPeak = std::max(blockPeak, std::fabs(chunk_[static_cast<size_t>(i)]));
+            }
+        }
+
+        level_ = blockPeak;
+    }
+
+    // ------------------------------------------------------------
+    // Live parameters
+    // ------------------------------------------------------------
+    void updateParams(const VoiceParams& vp)
+    {
+        env_.setAttack(vp.envAttack);
+        env_.setRelease(vp.envRelease);
+    }
+
+    void handleController(int cc, float norm) override
+    {
+        norm = juce::jlimit(0.0f, 1.0f, norm);
+
+        switch (cc)
+        {
+            case 3: env_.setAttack(ControllerCurves::attackSeconds(norm)); break;
+            case 4: env_.setRelease(ControllerCurves::releaseSeconds(norm)); break;
+            case 6: spread_ = 0.02f * norm;                 retune(); break;
+            case 7: q_      = 10.0f * std::pow(30.0f, norm); retune(); break;
+            case 8: tilt_   = 2.0f * norm;                  retune(); break;
+            default: break;
+        }
+    }
+
+    // Takes effect at the next note-on.
+    void setNumBands(int n) noexcept { numBands_ = std::clamp(n, minBands, maxBands); }
+    int  getNumBands() const noexcept { return numBands_; }
+
+    void setSpread(float s) noexcept { spread_ = std::max(0.0f, s); }
+    void setQ(float q) noexcept      { q_ = std::max(0.5f, q); }
+    void setTilt(float t) noexcept   { tilt_ = std::max(0.0f, t); }
+
+    // Centre frequency of band b for the current note.
+    double getBandCentreHz(int b) const noexcept
+    {
+        return baseHz_ * (b + 1) * (1.0 + static_cast<double>(spread_) * b);
+    }
+
+private:
+    // Per-band weight w_b and makeup so the summed output sits near
+    // a fixed RMS regardless of band count and Q.
+    void configureBands()
+    {
+        bank_.setNumBands(numBands_);
+
+        double sumW2 = 0.0;
+        for (int b = 0; b < numBands_; ++b)
+        {
+            const double w = std::pow(static_cast<double>(b + 1), -static_cast<double>(tilt_));
+            if (getBandCentreHz(b) < 0.45 * sampleRate_)
+                sumW2 += w * w;
+        }
+        const double norm = (sumW2 > 0.0) ? outputRms / std::sqrt(sumW2) : 0.0;
+
+        for (int b = 0; b < numBands_; ++b)
+        {
+            const double fc = getBandCentreHz(b);
+            const double w  = std::pow(static_cast<double>(b + 1), -static_cast<double>(tilt_));
+
+            // Unit-variance band output from uniform noise (σ² = 1/3):
+            // the normalised band-pass passes ENBW = (π/2)·fc/Q.
+            const double enbw   = 0.5 * juce::MathConstants<double>::pi * fc / static_cast<double>(q_);
+            const double makeup = std::sqrt(3.0 * 0.5 * sampleRate_ / std::max(enbw, 1.0));
+
+            bank_.setBand(b, fc, q_, static_cast<float>(makeup * norm));
+
+            const float decaySec = baseDecaySec / (1.0f + 0.15f * static_cast<float>(b));
+            env_.setBand(b, static_cast<float>(w), decaySec);
+        }
+    }
+
+    // Live CC moves re-tune the sounding note's bands.
+    void retune()
+    {
+        if (active_)
+            configureBands();
+    }
+
+    float nextNoise() noexcept
+    {
+        noiseState_ = noiseState_ * 1664525u + 1013904223u;
+        return static_cast<float>(static_cast<int32_t>(noiseState_)) * (1.0f / 2147483648.0f);
+    }
+
+    static constexpr double outputRms    = 0.15;
+    static constexpr float  baseDecaySec = 1.5f;
+
+    FreqBandEns bank_;
+    EnvelopeEns env_;
+
+    std::array<float, maxChunk> noise_ {};
+    std::array<float, maxChunk> chunk_ {};
+    uint32_t noiseState_ = 22222u;
+
+    int   numBands_ = defaultBands;
+    float spread_   = 0.0f;
+    float q_        = 80.0f;
+    float tilt_     = 1.0f;
+
+    double sampleRate_ = 44100.0;
+    double baseHz_     = 440.0;
+
+    bool  active_ = false;
+    int   note_   = -1;
+    float level_  = 0.0f;
+};
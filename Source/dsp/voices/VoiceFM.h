@@ -0,0 +1,396 @@
+#pragma once
+#include <juce_core/juce_core.h>
+#include "dsp/BaseVoice.h"
+#include "dsp/ControllerRouting.h"
+#include "dsp/DspTables.h"
+#include "dsp/envelopes/EnvelopeFM.h"
+#include "dsp/oscillators/SineTable.h"
+#include "params/ParameterSnapshot.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+// ============================================================
+// VoiceFM — 4-operator phase-modulation voice
+// ------------------------------------------------------------
+// Operators are numbered 0..3; operator 3 is always the top of the
+// routing and carries the self-feedback path.
+//
+// Layout: operator state is SoA (phase[], inc[], level[] ...) and
+// the per-operator envelopes are rendered into envBlock_[op][] once
+// per chunk, so the inner loop only reads flat arrays.
+//
+// Algorithms: each routing is a template instantiation of
+// renderAlgorithm<Alg>(); modulator/carrier masks are constexpr, so
+// every routing compiles to its own branch-free inner loop. The
+// runtime algorithm choice is one table lookup per chunk.
+// ============================================================
+
+enum class FMAlgorithm : int
+{
+    Stack      = 0,   // 3→2→1→0
+    TwoStacks  = 1,   // 3→2, 1→0           carriers 0,2
+    Branch     = 2,   // 3,2,1 → 0
+    DualMod    = 3,   // 3→2→0, 1→0
+    OneToThree = 4,   // 3 → 0,1,2          carriers 0,1,2
+    Parallel   = 5,   // all carriers
+};
+
+class VoiceFM : public BaseVoice {
+public:
+    static constexpr int numOps        = 4;
+    static constexpr int numAlgorithms = 6;
+    static constexpr int maxChunk      = 64;
+
+    // ------------------------------------------------------------
+    // Routing tables
+    // modulators[k]: bit j set → operator j phase-modulates k
+    // carriers:      bit k set → operator k is summed to the output
+    // ------------------------------------------------------------
+    struct Routing
+    {
+        std::array<unsigned, numOps> modulators;
+        unsigned carriers;
+    };
+
+    static constexpr std::array<Routing, numAlgorithms> routings {{
+        { { 0b0010u, 0b0100u, 0b1000u, 0u }, 0b0001u },   // Stack
+        { { 0b0010u, 0u,      0b1000u, 0u }, 0b0101u },   // TwoStacks
+        { { 0b1110u, 0u,      0u,      0u }, 0b0001u },   // Branch
+        { { 0b0110u, 0u,      0b1000u, 0u }, 0b0001u },   // DualMod
+        { { 0b1000u, 0b1000u, 0b1000u, 0u }, 0b0111u },   // OneToThree
+        { { 0u,      0u,      0u,      0u }, 0b1111u },   // Parallel
+    }};
+
+    // ------------------------------------------------------------
+    // BaseVoice
+    // ------------------------------------------------------------
+    void prepare(double sampleRate) override
+    {
+        sampleRate_ = sampleRate > 0.0 ? sampleRate : 44100.0;
+
+        for (auto& e : env_)
+            e.prepare(sampleRate_);
+
+        applyEnvelopeShapes();
+
+        phase_.fill(0u);
+        inc_.fill(0u);
+        feedbackHist_ = { 0.0f, 0.0f };
+
+        active_ = false;
+        note_   = -1;
+        level_  = 0.0f;
+    }
+
+    void noteOn(const ParameterSnapshot& snapshot, int midiNote, float /*velocity*/) override
+    {
+        baseHz_ = midiNoteToHz(midiNote);
+
+        attackSec_  = snapshot.envAttack;
+        releaseSec_ = snapshot.envRelease;
+        applyEnvelopeShapes();
+
+        phase_.fill(0u);
+        feedbackHist_ = { 0.0f, 0.0f };
+        updateIncrements();
+
+        for (auto& e : env_)
+            e.noteOn();
+
+        DBG("VoiceFM::noteOn midiNote=" << midiNote
+            << " baseHz=" << baseHz_
+            << " algorithm=" << static_cast<int>(algorithm_));
+
+        active_ = true;
+        note_   = midiNote;
+        level_  = 0.0f;
+    }
+
+    void noteOff() override
+    {
+        for (auto& e : env_)
+            e.noteOff();
+    }
+
+    bool  isActive() const override          { return active_; }
+    int   getNote() const noexcept override  { return note_; }
+    float getCurrentLevel() const override   { return level_; }
+
+    void render(float* buffer, int numSamples) override
+    {
+        if (!active_)
+            return;
+
+        const auto kernel = kernels()[static_cast<size_t>(algorithm_)];
+        const unsigned carriers = routings[static_cast<size_t>(algorithm_)].carriers;
+
+        // Modulation depth applies to modulators only.
+        for (int k = 0; k < numOps; ++k)
+        {
+            const bool isCarrier = (carriers >> k) & 1u;
+            effLevel_[static_cast<size_t>(k)] =
+                opLevel_[static_cast<size_t>(k)] * (isCarrier ? 1.0f : modDepth_);
+        }
+
+        float blockPeak = 0.0f;
+
+        for (int start = 0; start < numSamples; start += maxChunk)
+        {
+            const int n = std::min(maxChunk, numSamples - start);
+
+            for (int k = 0; k < numOps; ++k)
+                env_[static_cast<size_t>(k)].renderBlock(envBlock_[static_cast<size_t>(k)].data(), n);
+
+            std::fill(chunk_.begin(), chunk_.begin() + n, 0.0f);
+            (this->*kernel)(chunk_.data(), n);
+
+            for (int i = 0; i < n; ++i)
+            {
+                buffer[start + i] += chunk_[static_cast<size_t>(i)];
+                blockPeak = std::max(blockPeak, std::fabs(chunk_[static_cast<size_t>(i)]));
+            }
+        }
+
+        level_ = blockPeak;
+
+        // Voice ends once every carrier envelope has finished.
+        bool anyCarrier = false;
+        for (int k = 0; k < numOps; ++k)
+            if (((carriers >> k) & 1u) && env_[static_cast<size_t>(k)].isActive())
+                anyCarrier = true;
+
+        if (!anyCarrier)
+            active_ = false;
+    }
+
+    // ------------------------------------------------------------
+    // Live parameters
+    // ------------------------------------------------------------
+    void updateParams(const VoiceParams& vp)
+    {
+        attackSec_  = vp.envAttack;
+        releaseSec_ = vp.envRelease;
+        applyEnvelopeShapes();
+    }
+
+    // CC3/CC4 follow VoiceA's attack/release curves;
+    // CC6 algorithm, CC7 modulation depth, CC8 feedback.
+    void handleController(int cc, float norm) override
+    {
+        norm = juce::jlimit(0.0f, 1.0f, norm);
+
+        switch (cc)
+        {
+            case 3:
+                attackSec_ = ControllerCurves::attackSeconds(norm);
+                applyEnvelopeShapes();
+                break;
+
+            case 4:
+                releaseSec_ = ControllerCurves::releaseSeconds(norm);
+                applyEnvelopeShapes();
+                break;
+
+            case 6:
+                setAlgorithm(static_cast<FMAlgorithm>(
+                    std::min(numAlgorithms - 1, static_cast<int>(norm * numAlgorithms))));
+                break;
+
+            case 7:
+                modDepth_ = 2.0f * norm;
+                break;
+
+            case 8:
+                feedback_ = norm;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void setAlgorithm(FMAlgorithm a) noexcept
+    {
+        const int i = static_cast<int>(a);
+        algorithm_ = (i >= 0 && i < numAlgorithms) ? a : FMAlgorithm::Stack;
+    }
+
+    FMAlgorithm getAlgorithm() const noexcept { return algorithm_; }
+
+    // Frequency ratio to the note frequency.
+    void setOperatorRatio(int op, float ratio)
+    {
+        if (op < 0 || op >= numOps) return;
+        ratio_[static_cast<size_t>(op)] = std::max(0.0f, ratio);
+        updateIncrements();
+    }
+
+    // Carrier: output amplitude. Modulator: peak phase deviation (radians).
+    void setOperatorLevel(int op, float level)
+    {
+        if (op < 0 || op >= numOps) return;
+        opLevel_[static_cast<size_t>(op)] = level;
+    }
+
+    // Decay/sustain per operator; attack/release stay global.
+    void setOperatorEnvelope(int op, float decaySec, float sustain)
+    {
+        if (op < 0 || op >= numOps) return;
+        decaySec_[static_cast<size_t>(op)] = decaySec;
+        sustain_[static_cast<size_t>(op)]  = sustain;
+        applyEnvelopeShapes();
+    }
+
+    void  setModulationDepth(float d) noexcept { modDepth_ = std::max(0.0f, d); }
+    float getModulationDepth() const noexcept  { return modDepth_; }
+
+    // Self-feedback on operator 3 (radians per unit output).
+    void  setFeedback(float fb) noexcept { feedback_ = std::max(0.0f, fb); }
+    float getFeedback() const noexcept   { return feedback_; }
+
+    // Diagnostics / reference-model access
+    uint32_t getPhaseIncrement(int op) const noexcept { return inc_[static_cast<size_t>(op)]; }
+    float    getOperatorLevel(int op) const noexcept  { return opLevel_[static_cast<size_t>(op)]; }
+
+    static constexpr float carrierGain(unsigned carriers) noexcept
+    {
+        int n = 0;
+        for (int k = 0; k < numOps; ++k)
+            n += static_cast<int>((carriers >> k) & 1u);
+        return n > 0 ? 1.0f / static_cast<float>(n) : 0.0f;
+    }
+
+private:
+    using Kernel = void (VoiceFM::*)(float*, int) noexcept;
+
+    static float midiNoteToHz(int note) noexcept
+    {
+        return DspTables::get().noteToHz(note);
+    }
+
+    void updateIncrements() noexcept
+    {
+        for (int k = 0; k < numOps; ++k)
+            inc_[static_cast<size_t>(k)] = SineTable::incrementFor(
+                static_cast<double>(baseHz_) * static_cast<double>(ratio_[static_cast<size_t>(k)]),
+                sampleRate_);
+    }
+
+    void applyEnvelopeShapes()
+    {
+        for (int k = 0; k < numOps; ++k)
+            env_[static_cast<size_t>(k)].setADSR(attackSec_,
+                                                 decaySec_[static_cast<size_t>(k)],
+                                                 sustain_[static_cast<size_t>(k)],
+                                                 releaseSec_);
+    }
+
+    // ------------------------------------------------------------
+    // Compile-time routing helpers
+    // ------------------------------------------------------------
+    template <unsigned Mask, size_t... J>
+    static float sumMasked(const float* y, std::index_sequence<J...>) noexcept
+    {
+        float m = 0.0f;
+        ((((Mask >> J) & 1u) ? (void)(m += y[J]) : (void)0), ...);
+        return m;
+    }
+
+    template <int Alg, int K>
+    void evalOperator(float* y, const uint32_t* ph, int i) noexcept
+    {
+        constexpr unsigned mods = routings[static_cast<size_t>(Alg)].modulators[static_cast<size_t>(K)];
+
+        float pm = sumMasked<mods>(y, std::make_index_sequence<numOps>{});
+
+        if constexpr (K == numOps - 1)
+            pm += feedback_ * 0.5f * (feedbackHist_[0] + feedbackHist_[1]);
+
+        y[K] = SineTable::lookup(ph[K] + SineTable::radiansToPhase(pm))
+             * envBlock_[static_cast<size_t>(K)][static_cast<size_t>(i)]
+             * effLevel_[static_cast<size_t>(K)];
+    }
+
+    template <int Alg>
+    void renderAlgorithm(float* out, int n) noexcept
+    {
+        static_assert(numOps == 4, "renderAlgorithm evaluates operators 3..0 explicitly");
+
+        constexpr unsigned carriers = routings[static_cast<size_t>(Alg)].carriers;
+        constexpr float    gain     = carrierGain(carriers);
+
+        uint32_t ph[numOps];
+        for (int k = 0; k < numOps; ++k)
+            ph[k] = phase_[static_cast<size_t>(k)];
+
+        for (int i = 0; i < n; ++i)
+        {
+            float y[numOps] = {};
+
+            // Top-down: every modulator is evaluated before its target.
+            evalOperator<Alg, 3>(y, ph, i);
+            evalOperator<Alg, 2>(y, ph, i);
+            evalOperator<Alg, 1>(y, ph, i);
+            evalOperator<Alg, 0>(y, ph, i);
+
+            feedbackHist_[1] = feedbackHist_[0];
+            feedbackHist_[0] = y[numOps - 1];
+
+            out[i] += gain * sumMasked<carriers>(y, std::make_index_sequence<numOps>{});
+
+            for (int k = 0; k < numOps; ++k)
+                ph[k] += inc_[static_cast<size_t>(k)];
+        }
+
+        for (int k = 0; k < numOps; ++k)
+            phase_[static_cast<size_t>(k)] = ph[k];
+    }
+
+    template <size_t... A>
+    static constexpr std::array<Kernel, numAlgorithms> makeKernels(std::index_sequence<A...>) noexcept
+    {
+        return { { &VoiceFM::renderAlgorithm<static_cast<int>(A)>... } };
+    }
+
+    static const std::array<Kernel, numAlgorithms>& kernels() noexcept
+    {
+        static constexpr std::array<Kernel, numAlgorithms> k =
+            makeKernels(std::make_index_sequence<numAlgorithms>{});
+        return k;
+    }
+
+    // ------------------------------------------------------------
+    // Operator state (SoA)
+    // ------------------------------------------------------------
+    std::array<uint32_t, numOps> phase_ {};
+    std::array<uint32_t, numOps> inc_   {};
+    std::array<float, numOps>    ratio_   { 1.0f, 1.0f, 2.0f, 3.0f };
+    std::array<float, numOps>    opLevel_ { 1.0f, 1.5f, 1.0f, 0.5f };
+    std::array<float, numOps>    effLevel_ {};
+    std::array<float, numOps>    decaySec_ { 0.3f, 0.6f, 0.4f, 0.8f };
+    std::array<float, numOps>    sustain_  { 0.8f, 0.5f, 0.7f, 0.4f };
+
+    std::array<EnvelopeFM, numOps> env_ {};
+    std::array<std::array<float, maxChunk>, numOps> envBlock_ {};
+    std::array<float, maxChunk> chunk_ {};
+
+    std::array<float, 2> feedbackHist_ { 0.0f, 0.0f };
+
+    FMAlgorithm algorithm_ = FMAlgorithm::Stack;
+    float modDepth_  = 1.0f;
+    float feedback_  = 0.0f;
+
+    float attackSec_  = 0.01f;
+    float releaseSec_ = 0.2f;
+
+    double sampleRate_ = 44100.0;
+    float  baseHz_     = 440.0f;
+
+    bool  active_ = false;
+    int   note_   = -1;
+    float level_  = 0.0f;
+};
@@ -0,0 +1,255 @@
+#pragma once
+
+#include "dsp/voices/VoiceDopp.h"
+
+#include <algorithm>
+#include <cmath>
+
+// ============================================================
+// VoiceLET — relativistic Doppler on the VoiceDopp field
+// ------------------------------------------------------------
+// Shares VoiceDopp's kinematics, emitter lattice, CC routing and
+// attenuation kernel; only the propagation law changes
+// (docs/VOICE_TYPE_ROADMAP.md §2):
+//
+//   β      = v/c, ParameterSnapshot::relVelocity (CC6, §2.2.2),
+//            clamped to < 0.99
+//   γ      = 1 / sqrt(1 − β²)
+//   β_rad  = β · (heading · unit vector to the selected emitter)
+//   D      = sqrt((1 + β_rad) / (1 − β_rad))
+//
+// The carrier and field pulse are heard at f·D, and the envelope
+// runs on the listener's proper time (dτ = dt / γ).
+//
+// β is sampled from the snapshot at note-on and follows voice
+// control 6 live. Control 6 is the listener heading in VoiceDopp;
+// here the heading keeps its note-on value, while CC5 still moves
+// the listener through the lattice (geometry and attenuation).
+//
+// Aliasing: the pulse-modulated carrier has partials up to
+// (f_carrier + f_pulse)·D. Instead of VoiceDopp's oversampling the
+// voice fades out as that top partial approaches Nyquist.
+//
+// Cost: γ, D and the attenuation are evaluated once per block
+// (at the block end) and linearly interpolated from the previous
+// block's end values, so the per-sample path has no sqrt/exp.
+// ============================================================
+
+class VoiceLET : public VoiceDopp
+{
+public:
+    VoiceLET()  = default;
+    ~VoiceLET() override = default;
+
+    static constexpr double betaMax = 0.99;
+
+    void noteOn(const ParameterSnapshot& snapshot,
+                int midiNote,
+                float velocity) override
+    {
+        VoiceDopp::noteOn(snapshot, midiNote, velocity);
+
+        carrierPhase_   = basePhaseRad_;
+        pulsePhase_     = 0.0;
+        properTimeSec_  = 0.0;
+        hasBlockState_  = false;
+        betaNorm_       = snapshot.relVelocity;
+    }
+
+    // Control 6 is v/c for this voice; everything else as VoiceDopp.
+    void handleController(int cc, float norm) override
+    {
+        if (cc == 6)
+        {
+            betaNorm_ = norm;
+            return;
+        }
+
+        VoiceDopp::handleController(cc, norm);
+    }
+
+    // ------------------------------------------------------------
+    // Pure math helpers (public for tests)
+    // ------------------------------------------------------------
+    static double clampBeta(double beta) noexcept
+    {
+        return juce::jlimit(-betaMax, betaMax, beta);
+    }
+
+    static double computeLorentzGamma(double beta) noexcept
+    {
+        const double b = clampBeta(beta);
+        return 1.0 / std::sqrt(1.0 - b * b);
+    }
+
+    // Positive betaRad = approaching (blueshift).
+    static double computeRelativisticDoppler(double betaRad) noexcept
+    {
+        const double b = clampBeta(betaRad);
+        return std::sqrt((1.0 + b) / (1.0 - b));
+    }
+
+    // Current v/c (snapshot / control 6), clamped.
+    double getBeta() const noexcept
+    {
+        return juce::jlimit(0.0, betaMax, static_cast<double>(betaNorm_));
+    }
+
+    // Highest partial for a Doppler ratio: both pulse sidebands of
+    // the carrier are shifted, as in VoiceDopp::predictTopPartialHz().
+    double topPartialHz(double dopplerRatio) const noexcept
+    {
+        return (std::abs(baseFrequencyHz_) + std::abs(fieldPulseHz_)) * dopplerRatio;
+    }
+
+    // Values reached at the end of the most recent audible block.
+    double getBlockDopplerRatio() const noexcept { return dopplerEnd_; }
+    double getLorentzGamma()      const noexcept { return gammaEnd_; }
+
+    // Listener proper time since note-on (envelope timebase).
+    double getEnvelopeTimeSec()   const noexcept { return properTimeSec_; }
+
+protected:
+    void renderAudibleBlock(float* buffer, int numSamples,
+                            const BlockGeometry& g, double scaledSpeed) override
+    {
+        juce::ignoreUnused(scaledSpeed);
+
+        // The Nyquist guard below replaces oversampling for this voice.
+        activeOsFactor_ = 1;
+
+        const double sr = sampleRate_;
+        if (sr <= 0.0 || numSamples <= 0)
+            return;
+
+        // ============================================================
+        // Block-rate physics (one sqrt/exp set per block)
+        // ============================================================
+        const double dtBlock = static_cast<double>(numSamples) / sr;
+
+        const juce::Point<float> posEnd {
+            g.posStart.x + static_cast<float>(g.vx * dtBlock),
+            g.posStart.y + static_cast<float>(g.vy * dtBlock)
+        };
+
+        const double beta  = getBeta();
+        const auto   uvec  = computeUnitVector();
+
+        double rEnd = 0.0;
+        const double cosEnd = headingCosineTo(g.emitterPos, posEnd, uvec, rEnd);
+
+        const double gammaEnd   = computeLorentzGamma(beta);
+        const double dopplerEnd = computeRelativisticDoppler(beta * cosEnd);
+        const double attenEnd   = evalAttenuationKernel(rEnd);
+
+        if (!hasBlockState_)
+        {
+            // First audible block of the note: start from the current
+            // block-start geometry so there is nothing to glide from.
+            double rStart = 0.0;
+            const double cosStart = headingCosineTo(g.emitterPos, g.posStart, uvec, rStart);
+
+            gammaEnd_    = gammaEnd;
+            dopplerEnd_  = computeRelativisticDoppler(beta * cosStart);
+            attenEnd_    = evalAttenuationKernel(rStart);
+            hasBlockState_ = true;
+        }
+
+        const double gamma0   = gammaEnd_;
+        const double doppler0 = dopplerEnd_;
+        const double atten0   = attenEnd_;
+
+        const double guard0 = nyquistGuard(topPartialHz(doppler0), sr);
+        const double guard1 = nyquistGuard(topPartialHz(dopplerEnd), sr);
+
+        // ============================================================
+        // Per-sample synthesis: linear ramps + phase accumulators
+        // ============================================================
+        constexpr double twoPi = juce::MathConstants<double>::twoPi;
+
+        const double invN      = 1.0 / static_cast<double>(numSamples);
+        const double dDoppler  = (dopplerEnd - doppler0) * invN;
+        const double dInvGamma = (1.0 / gammaEnd - 1.0 / gamma0) * invN;
+        const double dAtten    = (attenEnd - atten0) * invN;
+        const double dGuard    = (guard1 - guard0) * invN;
+
+        const double carrierInc = twoPi * baseFrequencyHz_ / sr;
+        const double pulseInc   = twoPi * fieldPulseHz_ / sr;
+        const double dt         = 1.0 / sr;
+
+        double doppler  = doppler0;
+        double invGamma = 1.0 / gamma0;
+        double atten    = atten0;
+        double guard    = guard0;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            doppler  += dDoppler;
+            invGamma += dInvGamma;
+            atten    += dAtten;
+            guard    += dGuard;
+
+            carrierPhase_ += carrierInc * doppler;
+            pulsePhase_   += pulseInc * doppler;
+            properTimeSec_ += dt * invGamma;
+
+            // D < 3 at betaMax, but a wrap must never depend on that.
+            while (carrierPhase_ >= twoPi) carrierPhase_ -= twoPi;
+            while (pulsePhase_   >= twoPi) pulsePhase_   -= twoPi;
+
+            const double carrier = std::sin(carrierPhase_) * guard;
+            const double pulse   = 0.5 * (1.0 + std::sin(pulsePhase_));
+            const double env     = nextAdsrValue(properTimeSec_);
+
+            buffer[i] += static_cast<float>(carrier * env * pulse * atten);
+        }
+
+        gammaEnd_   = gammaEnd;
+        dopplerEnd_ = dopplerEnd;
+        attenEnd_   = attenEnd;
+    }
+
+private:
+    // cos of the angle between the heading and the direction from the
+    // listener at `pos` to the emitter; also returns that distance.
+    static double headingCosineTo(juce::Point<float> emitter,
+                                  juce::Point<float> pos,
+                                  juce::Point<float> heading,
+                                  double& distanceOut) noexcept
+    {
+        const double dx = static_cast<double>(emitter.x) - static_cast<double>(pos.x);
+        const double dy = static_cast<double>(emitter.y) - static_cast<double>(pos.y);
+        distanceOut = std::sqrt(dx * dx + dy * dy);
+
+        if (distanceOut <= 1.0e-12)
+            return 0.0;
+
+        return (dx * static_cast<double>(heading.x) + dy * static_cast<double>(heading.y))
+               / distanceOut;
+    }
+
+    // Fades the voice out as its shifted top partial approaches Nyquist.
+    static double nyquistGuard(double shiftedHz, double sr) noexcept
+    {
+        const double nyquist = 0.5 * sr;
+        const double fadeStart = nyquistGuardStart_ * nyquist;
+        const double f = std::abs(shiftedHz);
+
+        if (f <= fadeStart) return 1.0;
+        if (f >= nyquist)   return 0.0;
+        return (nyquist - f) / (nyquist - fadeStart);
+    }
+
+    static constexpr double nyquistGuardStart_ = 0.9;
+
+    float  betaNorm_      = 0.0f;   // v/c before clamping
+
+    double carrierPhase_  = 0.0;
+    double pulsePhase_    = 0.0;
+    double properTimeSec_ = 0.0;
+
+    bool   hasBlockState_ = false;
+    double gammaEnd_      = 1.0;
+    double dopplerEnd_    = 1.0;
+    double attenEnd_      = 0.0;
+};
@@ -1,12 +1,18 @@
 #include <juce_audio_processors/juce_audio_processors.h>
+#include "ParamLayout.h"
 #include "ParameterIDs.h"
+#include "dsp/VoiceRegistry.h"
+
+juce::String voiceParamID(int voiceIndex, int paramIndex)
+{
+    return juce::String(ParameterIDs::voiceGroupPrefix) + juce::String(voiceIndex + 1)
+         + "/" + voiceParamDescriptors[paramIndex].suffix;
+}
 
 juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout()
 {
     using namespace juce;
 
-    DBG("=== Building ParameterLayout (diagnostic multi-voice) ===");
-
     AudioProcessorValueTreeState::ParameterLayout layout;
 
     // ============================================================
@@ -27,23 +33,21 @@ juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout()
     // ============================================================
     // Global voice-mode selector (Phase III B3)
     // ------------------------------------------------------------
-    // IMPORTANT: The order here must match the VoiceMode enum
-    // (typically defined in ParameterSnapshot.h):
+    // Choice index i is VoiceMode(i) (ParameterSnapshot.h):
     //
     //   0 -> VoiceA
     //   1 -> VoiceDopp
     //   2 -> VoiceLET
     //   3 -> VoiceFM
+    //   4 -> VoiceEns
     //
-    // For now, the engine still instantiates only VoiceA, so
-    // changing this in the UI has *no* effect on DSP output yet.
+    // Each mode instantiates its own voice type (VoiceRegistry).
     // ============================================================
     {
+        // Generated from VoiceRegistry, so index i is always VoiceMode(i).
         StringArray modeNames;
-        modeNames.add("VoiceA");    // index 0 -> VoiceMode::VoiceA
-        modeNames.add("VoiceDopp"); // index 1 -> VoiceMode::VoiceDopp
-        modeNames.add("VoiceLET");  // index 2 -> VoiceMode::VoiceLET
-        modeNames.add("VoiceFM");   // index 3 -> VoiceMode::VoiceFM
+        for (int i = 0; i < VoiceRegistry::size; ++i)
+            modeNames.add(VoiceRegistry::displayName(static_cast<VoiceMode>(i)));
 
         layout.add(std::make_unique<AudioParameterChoice>(
             ParameterIDs::voiceMode,
@@ -53,6 +57,24 @@ juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout()
         ));
     }
 
+    // ============================================================
+    // Oscillator waveform — order must match the OscType enum
+    // ============================================================
+    {
+        StringArray oscNames;
+        oscNames.add("Sine");      // index 0 -> OscType::Sine
+        oscNames.add("Saw");       // index 1 -> OscType::Saw
+        oscNames.add("Square");    // index 2 -> OscType::Square
+        oscNames.add("Triangle");  // index 3 -> OscType::Triangle
+
+        layout.add(std::make_unique<AudioParameterChoice>(
+            ParameterIDs::oscType,
+            "Osc Type",
+            oscNames,
+            0 // default index: Sine
+        ));
+    }
+
     // ============================================================
     // Global (non-per-voice) DSP parameters
     // ============================================================
@@ -74,6 +96,69 @@ juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout()
         NormalisableRange<float>(0.01f, 5.0f),
         0.2f));
 
-    DBG("=== Done Building ParameterLayout ===");
+    // ============================================================
+    // Note-on gain shaping — curve order must match VelocityCurve
+    // ============================================================
+    {
+        StringArray curveNames;
+        curveNames.add("Linear");  // index 0 -> VelocityCurve::Linear
+        curveNames.add("Soft");    // index 1 -> VelocityCurve::Soft
+        curveNames.add("Hard");    // index 2 -> VelocityCurve::Hard
+        curveNames.add("Fixed");   // index 3 -> VelocityCurve::Fixed
+
+        layout.add(std::make_unique<AudioParameterChoice>(
+            ParameterIDs::velCurve,
+            "Velocity Curve",
+            curveNames,
+            0 // default index: Linear
+        ));
+    }
+
+    layout.add(std::make_unique<AudioParameterFloat>(
+        ParameterIDs::keyTrack,
+        "Key Track (dB/oct)",
+        NormalisableRange<float>(-12.0f, 12.0f, 0.1f),
+        0.0f));
+
+    layout.add(std::make_unique<AudioParameterBool>(
+        ParameterIDs::mpeEnabled,
+        "MPE",
+        false));
+
+    // ============================================================
+    // Engine — threads including the audio thread; 1 = serial.
+    // Takes effect on the next prepareToPlay, so not automatable.
+    // ============================================================
+    layout.add(std::make_unique<AudioParameterInt>(
+        ParameterIDs::renderThreads,
+        "Render Threads",
+        1, 4,
+        1,
+        AudioParameterIntAttributes().withAutomatable(false)));
+
+    // ============================================================
+    // Per-voice groups — generated from voiceParamDescriptors
+    // ============================================================
+    for (int v = 0; v < NUM_VOICES; ++v)
+    {
+        const String groupID   = String(ParameterIDs::voiceGroupPrefix) + String(v + 1);
+        const String groupName = "Voice " + String(v + 1);
+
+        auto group = std::make_unique<AudioProcessorParameterGroup>(groupID, groupName, "/");
+
+        for (int k = 0; k < numVoiceParams; ++k)
+        {
+            const auto& d = voiceParamDescriptors[k];
+
+            group->addChild(std::make_unique<AudioParameterFloat>(
+                voiceParamID(v, k),
+                groupName + " " + d.name,
+                NormalisableRange<float>(d.minValue, d.maxValue, d.interval, d.skew),
+                d.defaultValue));
+        }
+
+        layout.add(std::move(group));
+    }
+
     return layout;
 }
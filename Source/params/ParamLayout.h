@@ -15,3 +15,7 @@
 // ============================================================
 
 juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
+
+// "voices/voice<N>/<suffix>" for voiceIndex 0 … NUM_VOICES − 1 and a
+// VoiceParamIndex row of voiceParamDescriptors.
+juce::String voiceParamID(int voiceIndex, int paramIndex);
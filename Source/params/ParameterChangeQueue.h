@@ -0,0 +1,74 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// ============================================================
+// ParameterChangeQueue — audio thread → message thread
+// ------------------------------------------------------------
+// Single-producer / single-consumer ring of parameter changes.
+// The audio thread push()es (no locks, no allocation, never
+// blocks; a full ring returns false and the caller retries next
+// block), the message thread drain()s at UI rate and talks to the
+// host there.
+//
+// Each change carries a sequence number so the producer can tell
+// when the consumer has applied its latest value (see
+// MIDIControl001AudioProcessor::postHostParameterChanges()).
+// ============================================================
+
+struct ParameterChange
+{
+    int      index = 0;      // caller-defined slot (e.g. CcTarget)
+    float    value = 0.0f;   // normalised 0…1
+    uint32_t seq   = 0;
+};
+
+class ParameterChangeQueue {
+public:
+    static constexpr size_t capacity = 1024;   // power of two
+
+    // Audio thread.
+    bool push(const ParameterChange& change) noexcept
+    {
+        const size_t w = write_.load(std::memory_order_relaxed);
+        const size_t r = read_.load(std::memory_order_acquire);
+
+        if (w - r >= capacity)
+            return false;
+
+        ring_[w & (capacity - 1)] = change;
+        write_.store(w + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Message thread. Calls fn(change) in push order; returns the
+    // number of changes consumed.
+    template <typename Fn>
+    size_t drain(Fn&& fn)
+    {
+        const size_t r = read_.load(std::memory_order_relaxed);
+        const size_t w = write_.load(std::memory_order_acquire);
+
+        for (size_t i = r; i != w; ++i)
+            fn(ring_[i & (capacity - 1)]);
+
+        read_.store(w, std::memory_order_release);
+        return w - r;
+    }
+
+    size_t size() const noexcept
+    {
+        return write_.load(std::memory_order_acquire) - read_.load(std::memory_order_acquire);
+    }
+
+private:
+    static_assert((capacity & (capacity - 1)) == 0, "capacity must be a power of two");
+
+    std::array<ParameterChange, capacity> ring_ {};
+
+    // Separate lines: the two threads each own one index.
+    alignas(64) std::atomic<size_t> write_ { 0 };
+    alignas(64) std::atomic<size_t> read_  { 0 };
+};
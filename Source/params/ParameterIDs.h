@@ -19,14 +19,69 @@ namespace ParameterIDs {
     inline constexpr auto envAttack       = "env/attack";
     inline constexpr auto envRelease      = "env/release";
 
+    // ============================================================
+    // Note-on gain shaping
+    // ============================================================
+    inline constexpr auto velCurve        = "vel/curve";
+    inline constexpr auto keyTrack        = "key/track";
+
+    // ============================================================
+    // MIDI Polyphonic Expression (lower zone, 15 member channels)
+    // ============================================================
+    inline constexpr auto mpeEnabled      = "mpe/enable";
+
+    // ============================================================
+    // Engine (read in prepareToPlay, not per block)
+    // ============================================================
+    inline constexpr auto renderThreads   = "render/threads";
+
     // ============================================================
     // Scope parameters (GUI only)
     // ============================================================
     inline constexpr auto scopeEnabled    = "scope/enable";
     inline constexpr auto scopeBrightness = "scope/brightness";
+
+    // ============================================================
+    // Per-voice groups: "voices/voice<N>/<suffix>", N = 1 … NUM_VOICES
+    // Each group is a layer: pool slot i plays group i % NUM_VOICES.
+    // ============================================================
+    inline constexpr auto voiceGroupPrefix = "voices/voice";
 }
 
 // ============================================================
 // Voice configuration constants
 // ============================================================
 constexpr int NUM_VOICES = 3;
+
+// ============================================================
+// Per-voice parameter descriptors
+// ------------------------------------------------------------
+// One row per parameter in every voice group. ParamLayout
+// registers NUM_VOICES groups from this table, the processor
+// resolves the same IDs to value pointers once, and VoiceParams
+// takes its defaults from here. Row order is VoiceParamIndex.
+// ============================================================
+struct VoiceParamDescriptor
+{
+    const char* suffix;        // ID below the group, e.g. "env/attack"
+    const char* name;          // display name (prefixed "Voice N ")
+    float       minValue;
+    float       maxValue;
+    float       interval;      // 0 = continuous
+    float       skew;
+    float       defaultValue;
+};
+
+enum VoiceParamIndex : int
+{
+    voiceParamOscFreq,
+    voiceParamEnvAttack,
+    voiceParamEnvRelease,
+    numVoiceParams
+};
+
+inline constexpr VoiceParamDescriptor voiceParamDescriptors[numVoiceParams] = {
+    { "osc/freq",    "Osc Frequency", 20.0f,  20000.0f, 0.01f, 0.3f, 440.0f },
+    { "env/attack",  "Env Attack",    0.001f, 2.0f,     0.0f,  1.0f, 0.01f  },
+    { "env/release", "Env Release",   0.01f,  5.0f,     0.0f,  1.0f, 0.2f   },
+};
@@ -12,10 +12,9 @@
 //   1 -> VoiceDopp
 //   2 -> VoiceLET
 //   3 -> VoiceFM
+//   4 -> VoiceEns
 //
-// For now, the engine still instantiates only VoiceA for *all*
-// modes. That keeps DSP output identical while allowing the
-// plugin to carry a typed mode flag for future expansion.
+// Each mode instantiates its own voice type (VoiceRegistry).
 // ============================================================
 enum class VoiceMode : int
 {
@@ -23,23 +22,77 @@ enum class VoiceMode : int
     VoiceDopp = 1,
     VoiceLET  = 2,
     VoiceFM   = 3,
+    VoiceEns  = 4,
 };
 
+// Each value has a voice type in VoiceRegistry (dsp/VoiceRegistry.h),
+// which static_asserts this count and order.
+inline constexpr int numVoiceModes = 5;
+
 inline VoiceMode toVoiceMode(int raw)
+{
+    if (raw < 0 || raw >= numVoiceModes)
+        return VoiceMode::VoiceA;  // clamp bad indices
+    return static_cast<VoiceMode>(raw);
+}
+
+inline int toInt(VoiceMode m)
+{
+    return static_cast<int>(m);
+}
+
+// ============================================================
+// Oscillator waveform (ParameterIDs::oscType)
+// ------------------------------------------------------------
+// Order must match the "Osc Type" choice in ParamLayout.cpp.
+// Sine keeps the original OscillatorA path; the others read the
+// shared band-limited tables (OscillatorWT).
+// ============================================================
+enum class OscType : int
+{
+    Sine     = 0,
+    Saw      = 1,
+    Square   = 2,
+    Triangle = 3,
+};
+
+inline OscType toOscType(int raw)
 {
     switch (raw)
     {
-        case 0:  return VoiceMode::VoiceA;
-        case 1:  return VoiceMode::VoiceDopp;
-        case 2:  return VoiceMode::VoiceLET;
-        case 3:  return VoiceMode::VoiceFM;
-        default: return VoiceMode::VoiceA;  // clamp bad indices
+        case 1:  return OscType::Saw;
+        case 2:  return OscType::Square;
+        case 3:  return OscType::Triangle;
+        default: return OscType::Sine;
     }
 }
 
-inline int toInt(VoiceMode m)
+// ============================================================
+// Velocity → amplitude curve (ParameterIDs::velCurve)
+// ------------------------------------------------------------
+// Order must match the "Velocity Curve" choice in ParamLayout.cpp.
+// Tabulated in DspTables and folded into the voice gain at noteOn.
+//
+//   Linear  gain = v
+//   Soft    gain = √v   (louder at low velocities)
+//   Hard    gain = v²   (needs a firm touch)
+//   Fixed   gain = 1    (velocity ignored)
+// ============================================================
+enum class VelocityCurve : int
 {
-    return static_cast<int>(m);
+    Linear = 0,
+    Soft   = 1,
+    Hard   = 2,
+    Fixed  = 3,
+};
+
+inline constexpr int numVelocityCurves = 4;
+
+inline VelocityCurve toVelocityCurve(int raw)
+{
+    if (raw < 0 || raw >= numVelocityCurves)
+        return VelocityCurve::Linear;
+    return static_cast<VelocityCurve>(raw);
 }
 
 // ============================================================
@@ -47,9 +100,9 @@ inline int toInt(VoiceMode m)
 // ============================================================
 struct VoiceParams
 {
-    float oscFreq    = 440.0f;
-    float envAttack  = 0.01f;
-    float envRelease = 0.2f;
+    float oscFreq    = voiceParamDescriptors[voiceParamOscFreq].defaultValue;
+    float envAttack  = voiceParamDescriptors[voiceParamEnvAttack].defaultValue;
+    float envRelease = voiceParamDescriptors[voiceParamEnvRelease].defaultValue;
 };
 
 // Simple immutable snapshot of all relevant parameter values.
@@ -60,10 +113,20 @@ struct ParameterSnapshot {
     float     masterVolumeDb = -6.0f;
     float     masterMix      = 1.0f;
     VoiceMode voiceMode      = VoiceMode::VoiceA; // 0 == "voiceA"
+    OscType   oscType        = OscType::Sine;
     float     oscFreq        = 440.0f;
     float     envAttack      = 0.01f;
     float     envRelease     = 0.2f;
 
+    // Note-on gain shaping (DspTables::noteGain)
+    VelocityCurve velCurve   = VelocityCurve::Linear;
+    float     keyTrackDb     = 0.0f;   // dB per octave around middle C
+
+    bool      mpeEnabled     = false;
+
+    // VoiceLET v/c, 0 … 1 (voice control 6, see VoiceManager ccCache)
+    float     relVelocity    = 0.0f;
+
     // Per-voice parameter data
     std::array<VoiceParams, NUM_VOICES> voices {};
 };
@@ -0,0 +1,255 @@
+#pragma once
+#include "dsp/ControllerRouting.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+// ============================================================
+// StateCodec — compact binary plugin state
+// ------------------------------------------------------------
+// Layout (little-endian):
+//
+//   0  u32  magic 'MCST'
+//   4  u16  version
+//   6  u16  flags (bit 0: controller map present)
+//   8  u32  number of parameters
+//  12  u32  number of controller routes
+//  16       parameters: u8 id length, id bytes, f32 value (real units)
+//           routes:     u8 cc, u8 target, u8 curve, u8 0, f32 lo, f32 hi
+//
+// Parameters are keyed by ID, so a layout that gains or reorders
+// parameters still restores. Reader validates the whole blob once
+// and then hands out views into the caller's memory (no copies, no
+// allocation). Blobs without the magic are the older XML state.
+// ============================================================
+
+namespace StateCodec
+{
+    inline constexpr uint32_t magic   = 0x5453434Du;   // "MCST"
+    inline constexpr uint16_t version = 1;
+
+    enum Flags : uint16_t
+    {
+        hasControllerMap = 1 << 0,
+    };
+
+    inline constexpr size_t headerBytes = 16;
+    inline constexpr size_t routeBytes  = 12;
+    inline constexpr size_t maxIdBytes  = 255;
+
+    struct ParamValue
+    {
+        std::string_view id;
+        float            value = 0.0f;
+    };
+
+    namespace detail
+    {
+        inline void put8(uint8_t*& p, uint8_t v) noexcept { *p++ = v; }
+
+        inline void put16(uint8_t*& p, uint16_t v) noexcept
+        {
+            p[0] = static_cast<uint8_t>(v);
+            p[1] = static_cast<uint8_t>(v >> 8);
+            p += 2;
+        }
+
+        inline void put32(uint8_t*& p, uint32_t v) noexcept
+        {
+            for (int i = 0; i < 4; ++i)
+                p[i] = static_cast<uint8_t>(v >> (8 * i));
+            p += 4;
+        }
+
+        inline void putF32(uint8_t*& p, float f) noexcept
+        {
+            uint32_t v;
+            std::memcpy(&v, &f, sizeof v);
+            put32(p, v);
+        }
+
+        inline uint16_t get16(const uint8_t* p) noexcept
+        {
+            return static_cast<uint16_t>(p[0] | (p[1] << 8));
+        }
+
+        inline uint32_t get32(const uint8_t* p) noexcept
+        {
+            return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+                 | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+        }
+
+        inline float getF32(const uint8_t* p) noexcept
+        {
+            const uint32_t v = get32(p);
+            float f;
+            std::memcpy(&f, &v, sizeof f);
+            return f;
+        }
+
+        inline uint32_t countRoutes(const ControllerMap& map) noexcept
+        {
+            uint32_t n = 0;
+            for (int cc = 0; cc < ControllerMap::numControllers; ++cc)
+                n += map.route(cc).target != CcTarget::None ? 1u : 0u;
+            return n;
+        }
+    }
+
+    inline bool isBinaryState(const void* data, size_t size) noexcept
+    {
+        return data != nullptr && size >= headerBytes
+            && detail::get32(static_cast<const uint8_t*>(data)) == magic;
+    }
+
+    // ------------------------------------------------------------
+    // Writing: measure() the blob, then write() into that many bytes.
+    // IDs longer than maxIdBytes are skipped.
+    // ------------------------------------------------------------
+    inline size_t measure(const ParamValue* params, size_t numParams, const ControllerMap& map) noexcept
+    {
+        size_t bytes = headerBytes + routeBytes * detail::countRoutes(map);
+        for (size_t i = 0; i < numParams; ++i)
+            if (params[i].id.size() <= maxIdBytes)
+                bytes += 1 + params[i].id.size() + 4;
+        return bytes;
+    }
+
+    inline size_t write(uint8_t* dst, const ParamValue* params, size_t numParams, const ControllerMap& map) noexcept
+    {
+        uint8_t* p = dst;
+
+        uint32_t numWritten = 0;
+        for (size_t i = 0; i < numParams; ++i)
+            numWritten += params[i].id.size() <= maxIdBytes ? 1u : 0u;
+
+        detail::put32(p, magic);
+        detail::put16(p, version);
+        detail::put16(p, hasControllerMap);
+        detail::put32(p, numWritten);
+        detail::put32(p, detail::countRoutes(map));
+
+        for (size_t i = 0; i < numParams; ++i)
+        {
+            const auto id = params[i].id;
+            if (id.size() > maxIdBytes)
+                continue;
+
+            detail::put8(p, static_cast<uint8_t>(id.size()));
+            std::memcpy(p, id.data(), id.size());
+            p += id.size();
+            detail::putF32(p, params[i].value);
+        }
+
+        for (int cc = 0; cc < ControllerMap::numControllers; ++cc)
+        {
+            const auto& r = map.route(cc);
+            if (r.target == CcTarget::None)
+                continue;
+
+            detail::put8(p, static_cast<uint8_t>(cc));
+            detail::put8(p, static_cast<uint8_t>(r.target));
+            detail::put8(p, static_cast<uint8_t>(r.curve));
+            detail::put8(p, 0);
+            detail::putF32(p, r.lo);
+            detail::putF32(p, r.hi);
+        }
+
+        return static_cast<size_t>(p - dst);
+    }
+
+    // ------------------------------------------------------------
+    // Reading (zero-copy: views into `data`, which must outlive the
+    // Reader and anything taken from it)
+    // ------------------------------------------------------------
+    class Reader {
+    public:
+        Reader(const void* data, size_t size) noexcept
+            : data_(static_cast<const uint8_t*>(data)), size_(size)
+        {
+            valid_ = validate();
+        }
+
+        bool     isValid() const noexcept       { return valid_; }
+        uint16_t getVersion() const noexcept    { return version_; }
+        uint32_t getNumParams() const noexcept  { return numParams_; }
+
+        // fn(std::string_view id, float value) per stored parameter.
+        template <typename Fn>
+        void forEachParam(Fn&& fn) const
+        {
+            if (!valid_)
+                return;
+
+            const uint8_t* p = data_ + headerBytes;
+            for (uint32_t i = 0; i < numParams_; ++i)
+            {
+                const size_t len = *p++;
+                const std::string_view id(reinterpret_cast<const char*>(p), len);
+                p += len;
+                fn(id, detail::getF32(p));
+                p += 4;
+            }
+        }
+
+        // Fills `map` (cleared first) when the blob carries one.
+        // Routes to targets this build does not know are dropped.
+        bool readControllerMap(ControllerMap& map) const noexcept
+        {
+            if (!valid_ || (flags_ & hasControllerMap) == 0)
+                return false;
+
+            map = ControllerMap {};
+            const uint8_t* p = data_ + routesOffset_;
+            for (uint32_t i = 0; i < numRoutes_; ++i, p += routeBytes)
+            {
+                if (p[1] >= numCcTargets || p[2] >= numCcCurves)
+                    continue;
+
+                map.setRoute(p[0], CcRoute { static_cast<CcTarget>(p[1]), static_cast<CcCurve>(p[2]),
+                                             detail::getF32(p + 4), detail::getF32(p + 8) });
+            }
+            return true;
+        }
+
+    private:
+        bool validate() noexcept
+        {
+            if (!isBinaryState(data_, size_))
+                return false;
+
+            version_   = detail::get16(data_ + 4);
+            flags_     = detail::get16(data_ + 6);
+            numParams_ = detail::get32(data_ + 8);
+            numRoutes_ = detail::get32(data_ + 12);
+
+            if (version_ == 0 || version_ > version)
+                return false;   // written by a newer build
+
+            size_t offset = headerBytes;
+            for (uint32_t i = 0; i < numParams_; ++i)
+            {
+                if (offset >= size_)
+                    return false;
+
+                offset += 1 + data_[offset] + 4;
+                if (offset > size_)
+                    return false;
+            }
+
+            routesOffset_ = offset;
+            return size_ - offset >= routeBytes * static_cast<size_t>(numRoutes_);
+        }
+
+        const uint8_t* data_ = nullptr;
+        size_t   size_         = 0;
+        size_t   routesOffset_ = 0;
+        uint16_t version_      = 0;
+        uint16_t flags_        = 0;
+        uint32_t numParams_    = 0;
+        uint32_t numRoutes_    = 0;
+        bool     valid_        = false;
+    };
+}
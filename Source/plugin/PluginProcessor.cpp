@@ -2,34 +2,125 @@
 #include "PluginEditor.h"
 #include "params/ParameterIDs.h"
 #include "params/ParamLayout.h"
+#include "dsp/DspTables.h"
 
 static inline float ccTo01(int value)
 {
     return juce::jlimit(0.0f, 1.0f, value / 127.0f);
 }
 
+// ============================================================
+// Controller map from XML state (sessions saved before the binary
+// format)
+// ------------------------------------------------------------
+// <CC_MAP version="1">
+//   <ROUTE cc="3" target="env/attack" curve="linear" lo="0" hi="1"/>
+// </CC_MAP>
+// ============================================================
+static const juce::Identifier ccMapTag   { "CC_MAP" };
+static const juce::Identifier ccRouteTag { "ROUTE" };
+
+static ControllerMap controllerMapFromTree(const juce::ValueTree& tree)
+{
+    ControllerMap map;   // everything unmapped
+
+    for (const auto& route : tree)
+    {
+        if (!route.hasType(ccRouteTag))
+            continue;
+
+        CcRoute r;
+        if (!findCcTarget(route.getProperty("target").toString().toStdString(), r.target))
+            continue;   // target from a newer build: drop the route
+
+        findCcCurve(route.getProperty("curve").toString().toStdString(), r.curve);
+        r.lo = static_cast<float>(route.getProperty("lo", 0.0f));
+        r.hi = static_cast<float>(route.getProperty("hi", 1.0f));
+
+        map.setRoute(static_cast<int>(route.getProperty("cc", -1)), r);
+    }
+    return map;
+}
+
 // ============================================================
 // Processor class implementation
 // ============================================================
 
 MIDIControl001AudioProcessor::MIDIControl001AudioProcessor()
   : AudioProcessor(BusesProperties().withOutput("Output", juce::AudioChannelSet::stereo(), true)),
-    apvts(*this, nullptr, "Parameters", createParameterLayout()),
-    voiceManager_([this]{ return makeSnapshotFromParams(); })
-{}
+    apvts(*this, nullptr, "Parameters", createParameterLayout())
+{
+    // Construction stays cheap for host scans: tables are mapped and
+    // voices are built in prepareToPlay.
+    DspTables::setCacheFile(DspTables::defaultCacheFile());
+
+    // Resolved once so CC dispatch never looks parameters up by ID.
+    for (int t = 0; t < numCcTargets; ++t)
+        ccParams_[static_cast<size_t>(t)] =
+            dynamic_cast<juce::RangedAudioParameter*>(apvts.getParameter(ccTargetName(static_cast<CcTarget>(t))));
+
+    ccLive_.fill(-1.0f);
+    hostUnposted_.fill(-1.0f);
+
+    // Snapshot sources, resolved once: one snapshot per sub-block is
+    // then a handful of atomic loads with no ID lookups.
+    params_.masterVolume = apvts.getRawParameterValue(ParameterIDs::masterVolume);
+    params_.masterMix    = apvts.getRawParameterValue(ParameterIDs::masterMix);
+    params_.voiceMode    = apvts.getRawParameterValue(ParameterIDs::voiceMode);
+    params_.oscType      = apvts.getRawParameterValue(ParameterIDs::oscType);
+    params_.velCurve     = apvts.getRawParameterValue(ParameterIDs::velCurve);
+    params_.keyTrack     = apvts.getRawParameterValue(ParameterIDs::keyTrack);
+    params_.mpeEnabled   = apvts.getRawParameterValue(ParameterIDs::mpeEnabled);
+    params_.oscFreq      = apvts.getRawParameterValue(ParameterIDs::oscFreq);
+    params_.envAttack    = apvts.getRawParameterValue(ParameterIDs::envAttack);
+    params_.envRelease   = apvts.getRawParameterValue(ParameterIDs::envRelease);
+    params_.renderThreads = apvts.getRawParameterValue(ParameterIDs::renderThreads);
+
+    for (size_t v = 0; v < params_.voices.size(); ++v)
+        for (size_t k = 0; k < numVoiceParams; ++k)
+        {
+            params_.voices[v][k] = apvts.getRawParameterValue(voiceParamID(static_cast<int>(v), static_cast<int>(k)));
+            jassert(params_.voices[v][k] != nullptr);   // registered by createParameterLayout()
+        }
+
+    // IDs are viewed in place (the parameters own the strings).
+    for (auto* p : getParameters())
+        if (auto* ranged = dynamic_cast<juce::RangedAudioParameter*>(p))
+            stateParams_.push_back({ std::string_view(ranged->paramID.toRawUTF8(),
+                                                      ranged->paramID.getNumBytesAsUTF8()),
+                                     ranged });
+}
 
 void MIDIControl001AudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
     sampleRate_ = sampleRate;
-    voiceManager_.prepare(sampleRate_);
+
+    // Map (or build and persist) the shared lookup tables before the
+    // audio thread can construct a voice.
+    DspTables::get();
+
+    // The render pool is (re)started here, never from the audio thread.
+    if (params_.renderThreads != nullptr)
+        voiceManager_.setNumRenderThreads(static_cast<int>(params_.renderThreads->load()));
+
+    // Build the pool for the current mode here, so a note never
+    // constructs voices on the audio thread.
+    voiceManager_.setMode(makeSnapshotFromParams().voiceMode);
+    voiceManager_.prepare(sampleRate_, samplesPerBlock);
+    voiceManager_.prepareVoices();
 
     monoScratch_.setSize(1, samplesPerBlock);
     monoScratch_.clear();
+
+    // Posts CC-driven values to the host while playing; idle
+    // (scanned or unprepared) instances run no timer.
+    startTimerHz(30);
 }
 
 void MIDIControl001AudioProcessor::releaseResources()
 {
     DBG("releaseResources begin");
+    stopTimer();
     monoScratch_.setSize(0, 0);
 
     if (!juce::MessageManager::existsAndIsCurrentThread())
@@ -46,59 +137,48 @@ bool MIDIControl001AudioProcessor::isBusesLayoutSupported(const BusesLayout& lay
 }
 
 // ============================================================
-// Snapshot diagnostics
+// Snapshot construction
 // ============================================================
 
 ParameterSnapshot MIDIControl001AudioProcessor::makeSnapshotFromParams() const
 {
     ParameterSnapshot s;
 
-    if (auto* p = apvts.getRawParameterValue(ParameterIDs::masterVolume)) s.masterVolumeDb = p->load();
-    if (auto* p = apvts.getRawParameterValue(ParameterIDs::masterMix))    s.masterMix      = p->load();
+    if (auto* p = params_.masterVolume) s.masterVolumeDb = p->load();
+    if (auto* p = params_.masterMix)    s.masterMix      = p->load();
 
     // ============================================================
     // NEW FOR PHASE II — read global voice mode
     // (Phase III: convert to typed enum, still behavior-identical)
     // ============================================================
-    if (auto* p = apvts.getRawParameterValue(ParameterIDs::voiceMode))
+    if (auto* p = params_.voiceMode)
         s.voiceMode = toVoiceMode(static_cast<int>(p->load()));
 
-    if (auto* p = apvts.getRawParameterValue(ParameterIDs::oscFreq))      s.oscFreq        = p->load();
-    if (auto* p = apvts.getRawParameterValue(ParameterIDs::envAttack))    s.envAttack      = p->load();
-    if (auto* p = apvts.getRawParameterValue(ParameterIDs::envRelease))   s.envRelease     = p->load();
+    if (auto* p = params_.oscType)
+        s.oscType = toOscType(static_cast<int>(p->load()));
+
+    if (auto* p = params_.velCurve)
+        s.velCurve = toVelocityCurve(static_cast<int>(p->load()));
+
+    if (auto* p = params_.keyTrack)     s.keyTrackDb     = p->load();
+    if (auto* p = params_.mpeEnabled)   s.mpeEnabled     = p->load() >= 0.5f;
+    if (auto* p = params_.oscFreq)      s.oscFreq        = p->load();
+    if (auto* p = params_.envAttack)    s.envAttack      = p->load();
+    if (auto* p = params_.envRelease)   s.envRelease     = p->load();
 
     // ============================================================
     // Per-voice parameter group reads
     // ============================================================
-    for (int i = 0; i < NUM_VOICES; ++i)
+    for (size_t i = 0; i < params_.voices.size(); ++i)
     {
-        VoiceParams vp;
+        const auto& vpp = params_.voices[i];
+        auto& vp = s.voices[i];
 
-        const juce::String prefix = "voices/voice" + juce::String(i + 1) + "/";
-
-        if (auto* p = apvts.getRawParameterValue(prefix + "osc/freq"))
-            vp.oscFreq = p->load();
-
-        if (auto* p = apvts.getRawParameterValue(prefix + "env/attack"))
-            vp.envAttack = p->load();
-
-        if (auto* p = apvts.getRawParameterValue(prefix + "env/release"))
-            vp.envRelease = p->load();
-
-        s.voices[i] = vp;
-
-        DBG("Voice" << (i + 1)
-            << " freq=" << vp.oscFreq
-            << " atk=" << vp.envAttack
-            << " rel=" << vp.envRelease);
+        vp.oscFreq    = vpp[voiceParamOscFreq]->load();
+        vp.envAttack  = vpp[voiceParamEnvAttack]->load();
+        vp.envRelease = vpp[voiceParamEnvRelease]->load();
     }
 
-    DBG("Snapshot built: vol=" << s.masterVolumeDb
-        << " mix=" << s.masterMix
-        << " mode=" << static_cast<int>(s.voiceMode)
-        << " atk=" << s.envAttack
-        << " rel=" << s.envRelease);
-
     return s;
 }
 
@@ -119,102 +199,162 @@ void MIDIControl001AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer
         monoScratch_.setSize(1, numSamples);
     monoScratch_.clear();
 
-    const auto snap = makeSnapshotFromParams();
-
-    // Phase II A5 — forward mode into VoiceManager
-    voiceManager_.setMode(snap.voiceMode);
+    releaseAppliedControllerValues();
 
     // ============================================================
-    // Phase IV A11-1 — runtime audio enablement
-    // We do NOT add APVTS param yet to avoid breaking tests.
-    // Rule: audible Doppler only when in VoiceDopp mode.
+    // Fixed internal sub-blocks
+    // ------------------------------------------------------------
+    // Parameters are re-sampled, and MIDI events applied, at every
+    // sub-block boundary, so automation and note timing resolve to
+    // subBlockSize samples whatever the host buffer size.
     // ============================================================
-    // Phase IV A11-1 — runtime audio enablement:
-    // Audio is ON only in VoiceDopp mode.
-    const bool enableAudio = (snap.voiceMode == VoiceMode::VoiceDopp);
-    voiceManager_.setAudioSynthesisEnabled(enableAudio);
-
-    voiceManager_.startBlock();
+    const int subBlock = subBlockSize_.load(std::memory_order_relaxed);
+    float* mono = monoScratch_.getWritePointer(0);
+    auto   event = midi.cbegin();
 
-    for (const auto metadata : midi)
+    for (int start = 0; start < numSamples; start += subBlock)
     {
-        const auto msg = metadata.getMessage();
+        const int n = std::min(subBlock, numSamples - start);
+
+        const auto snap = makeSnapshotFromParams();
+
+        // Phase II A5 — forward mode into VoiceManager
+        voiceManager_.setMode(snap.voiceMode);
+
+        // ============================================================
+        // Phase IV A11-1 — runtime audio enablement:
+        // Audio is ON only in the Doppler-field modes (VoiceDopp, VoiceLET).
+        // ============================================================
+        const bool enableAudio = (snap.voiceMode == VoiceMode::VoiceDopp
+                               || snap.voiceMode == VoiceMode::VoiceLET);
+        voiceManager_.setAudioSynthesisEnabled(enableAudio);
 
-        DBG("MIDI message: " << msg.getDescription());
+        // MPE lower zone: channel 1 master, channels 2–16 one note each
+        voiceManager_.setMpeMemberChannels(snap.mpeEnabled ? 15 : 0);
 
-        if (msg.isNoteOn())
-            DBG("  NoteOn  #" << msg.getNoteNumber()
-                << " → freq=" << 440.0f * std::pow(2.0f, (msg.getNoteNumber() - 69) / 12.0f));
+        voiceManager_.startBlock(snap);
 
-        if (msg.isController())
-            DBG("  Controller #" << msg.getControllerNumber()
-                << " value=" << msg.getControllerValue());
+        for (; event != midi.cend() && (*event).samplePosition < start + n; ++event)
+            handleMidiMessage((*event).getMessage());
 
-        if (msg.isController())
+        voiceManager_.render(mono + start, n);
+
+        const float mix  = juce::jlimit(0.0f, 1.0f, hostValue(CcTarget::MasterMix, snap.masterMix));
+        const float gain = juce::Decibels::decibelsToGain(hostValue(CcTarget::MasterVolume, snap.masterVolumeDb));
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            juce::FloatVectorOperations::copyWithMultiply(buffer.getWritePointer(ch, start), mono + start, mix * gain, n);
+    }
+
+    postHostParameterChanges();
+}
+
+void MIDIControl001AudioProcessor::handleMidiMessage(const juce::MidiMessage& msg)
+{
+    DBG("MIDI message: " << msg.getDescription());
+
+    if (msg.isNoteOn())
+        DBG("  NoteOn  #" << msg.getNoteNumber()
+            << " → freq=" << 440.0f * std::pow(2.0f, (msg.getNoteNumber() - 69) / 12.0f));
+
+    if (msg.isController())
+        DBG("  Controller #" << msg.getControllerNumber()
+            << " value=" << msg.getControllerValue());
+
+    // Per-note expression: O(1) to the owning voice on MPE member
+    // channels, otherwise applied to all voices.
+    if (msg.isPitchWheel())
+        voiceManager_.handlePitchBend(msg.getChannel(), (msg.getPitchWheelValue() - 8192) / 8192.0f);
+    else if (msg.isChannelPressure())
+        voiceManager_.handleChannelPressure(msg.getChannel(), msg.getChannelPressureValue() / 127.0f);
+    else if (msg.isController() && msg.getControllerNumber() == 74
+             && voiceManager_.isMpeMemberChannel(msg.getChannel()))
+        voiceManager_.handleTimbre(msg.getChannel(), ccTo01(msg.getControllerValue()));
+    else if (msg.isController())
+    {
+        const int   cc   = msg.getControllerNumber();
+        const float norm = ccTo01(msg.getControllerValue());
+
+        // One table for every consumer: the engine (cache + voice
+        // controls) and, for host targets, the parameter itself.
+        voiceManager_.handleController(cc, norm);
+
+        // Host targets: used by this block at once, reported to
+        // the host later from the message thread.
+        const auto& route = voiceManager_.getControllerMap().route(cc);
+        const auto  t     = static_cast<size_t>(route.target);
+        if (ccParams_[t] != nullptr)
         {
-            const int   cc   = msg.getControllerNumber();
-            const int   val  = msg.getControllerValue();
-            const float norm = ccTo01(val);
-
-            switch (cc)
-            {
-                case 1:
-                    if (auto* p = apvts.getParameter(ParameterIDs::masterVolume))
-                        p->setValueNotifyingHost(norm);
-                    DBG("Mapped CC#1 (Mod Wheel) to masterVolume = " << norm);
-                    break;
-
-                case 2:
-                    if (auto* p = apvts.getParameter(ParameterIDs::masterMix))
-                        p->setValueNotifyingHost(norm);
-                    DBG("Mapped CC#2 (Breath) to masterMix = " << norm);
-                    break;
-
-                // ====================================================
-                // NEW: Phase III-B2 — map CC3/4/5 to global DSP params
-                // (these are ALSO fed into VoiceManager::handleController)
-                // ====================================================
-                case 3:
-                    if (auto* p = apvts.getParameter(ParameterIDs::envAttack))
-                        p->setValueNotifyingHost(norm);
-                    DBG("Mapped CC#3 to Env Attack (global) = " << norm);
-                    break;
-
-                case 4:
-                    if (auto* p = apvts.getParameter(ParameterIDs::envRelease))
-                        p->setValueNotifyingHost(norm);
-                    DBG("Mapped CC#4 to Env Release (global) = " << norm);
-                    break;
-
-                case 5:
-                    if (auto* p = apvts.getParameter(ParameterIDs::oscFreq))
-                        p->setValueNotifyingHost(norm);
-                    DBG("Mapped CC#5 to Osc Frequency (global) = " << norm);
-                    break;
-
-                default:
-                    break;
-            }
-
-            // Always forward to voice engine (persistent CC cache etc.)
-            voiceManager_.handleController(cc, norm);
+            ccLive_[t] = hostUnposted_[t] = route.shape(norm);
+            DBG("Mapped CC#" << cc << " to " << ccTargetName(route.target) << " = " << ccLive_[t]);
         }
+    }
+
+    if      (msg.isNoteOn())  voiceManager_.handleNoteOn (msg.getNoteNumber(), msg.getFloatVelocity(), msg.getChannel());
+    else if (msg.isNoteOff()) voiceManager_.handleNoteOff(msg.getNoteNumber(), msg.getChannel());
+}
 
-        if      (msg.isNoteOn())  voiceManager_.handleNoteOn (msg.getNoteNumber(), msg.getFloatVelocity());
-        else if (msg.isNoteOff()) voiceManager_.handleNoteOff(msg.getNoteNumber());
+// ============================================================
+// CC → host parameter hand-off
+// ============================================================
+
+// Audio thread: a live value is dropped once the message thread has
+// applied the last one posted for it; APVTS then holds the same value.
+void MIDIControl001AudioProcessor::releaseAppliedControllerValues() noexcept
+{
+    for (size_t t = 0; t < ccLive_.size(); ++t)
+        if (ccLive_[t] >= 0.0f && hostUnposted_[t] < 0.0f
+            && hostAppliedSeq_[t].load(std::memory_order_acquire) == hostPostedSeq_[t])
+            ccLive_[t] = -1.0f;
+}
+
+// Audio thread: one queue entry per touched target per block (the
+// last value); a full queue is retried next block.
+void MIDIControl001AudioProcessor::postHostParameterChanges() noexcept
+{
+    for (size_t t = 0; t < hostUnposted_.size(); ++t)
+    {
+        if (hostUnposted_[t] < 0.0f)
+            continue;
+
+        const uint32_t seq = ++hostSeq_;
+        if (hostChanges_.push({ static_cast<int>(t), hostUnposted_[t], seq }))
+        {
+            hostPostedSeq_[t] = seq;
+            hostUnposted_[t]  = -1.0f;
+        }
     }
+}
 
-    float* mono = monoScratch_.getWritePointer(0);
-    voiceManager_.render(mono, numSamples);
+float MIDIControl001AudioProcessor::hostValue(CcTarget target, float paramValue) const noexcept
+{
+    const auto  t    = static_cast<size_t>(target);
+    const float live = ccLive_[t];
+    return (live >= 0.0f && ccParams_[t] != nullptr) ? ccParams_[t]->convertFrom0to1(live) : paramValue;
+}
 
-    const float mix  = juce::jlimit(0.0f, 1.0f, snap.masterMix);
-    const float gain = juce::Decibels::decibelsToGain(snap.masterVolumeDb);
+// Message thread: applies the newest queued value per parameter.
+void MIDIControl001AudioProcessor::flushHostParameterChanges()
+{
+    std::array<float, numCcTargets>    latest;
+    std::array<uint32_t, numCcTargets> seq {};
+    latest.fill(-1.0f);
+
+    hostChanges_.drain([&](const ParameterChange& c)
+    {
+        latest[static_cast<size_t>(c.index)] = c.value;
+        seq[static_cast<size_t>(c.index)]    = c.seq;
+    });
 
-    for (int ch = 0; ch < numChannels; ++ch)
+    for (size_t t = 0; t < latest.size(); ++t)
     {
-        auto* out = buffer.getWritePointer(ch);
-        for (int i = 0; i < numSamples; ++i)
-            out[i] = mono[i] * mix * gain;
+        if (latest[t] < 0.0f)
+            continue;
+
+        if (auto* p = ccParams_[t])
+            p->setValueNotifyingHost(latest[t]);
+
+        hostAppliedSeq_[t].store(seq[t], std::memory_order_release);
     }
 }
 
@@ -222,28 +362,104 @@ void MIDIControl001AudioProcessor::processBlock(juce::AudioBuffer<float>& buffer
 // State / Editor
 // ============================================================
 
+// Binary (StateCodec): parameter values in real units plus the
+// controller map, written straight into `dest`.
 void MIDIControl001AudioProcessor::getStateInformation(juce::MemoryBlock& dest)
 {
-    auto state = apvts.copyState();
-    if (auto xml = state.createXml())
-        copyXmlToBinary(*xml, dest);
+    std::vector<StateCodec::ParamValue> values;
+    values.reserve(stateParams_.size());
+
+    for (const auto& sp : stateParams_)
+        values.push_back({ sp.id, sp.param->convertFrom0to1(sp.param->getValue()) });
+
+    const auto map = getControllerMap();
+
+    dest.setSize(StateCodec::measure(values.data(), values.size(), map));
+    StateCodec::write(static_cast<uint8_t*>(dest.getData()), values.data(), values.size(), map);
 }
 
 void MIDIControl001AudioProcessor::setStateInformation(const void* data, int size)
+{
+    if (data == nullptr || size <= 0)
+        return;
+
+    if (StateCodec::isBinaryState(data, static_cast<size_t>(size)))
+        restoreBinaryState(data, static_cast<size_t>(size));
+    else
+        restoreXmlState(data, size);
+}
+
+// Stored order normally matches stateParams_, so `hint` (the slot
+// after the last match) hits first time; otherwise a linear scan.
+// Returns the index into stateParams_, or -1.
+int MIDIControl001AudioProcessor::findStateParam(std::string_view id, size_t& hint) const noexcept
+{
+    const size_t n = stateParams_.size();
+    for (size_t k = 0; k < n; ++k)
+    {
+        const size_t i = (hint + k) % n;
+        if (stateParams_[i].id == id)
+        {
+            hint = i + 1;
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+void MIDIControl001AudioProcessor::restoreBinaryState(const void* data, size_t size)
+{
+    const StateCodec::Reader reader(data, size);
+    if (!reader.isValid())
+        return;
+
+    // Parameters the blob doesn't mention (added since it was saved)
+    // return to their defaults, as with an APVTS replaceState().
+    std::vector<bool> restored(stateParams_.size(), false);
+    size_t hint = 0;
+
+    reader.forEachParam([&](std::string_view id, float value)
+    {
+        const int i = findStateParam(id, hint);
+        if (i < 0)
+            return;   // parameter removed since the session was saved
+
+        auto* p = stateParams_[static_cast<size_t>(i)].param;
+        p->setValueNotifyingHost(p->convertTo0to1(value));
+        restored[static_cast<size_t>(i)] = true;
+    });
+
+    for (size_t i = 0; i < stateParams_.size(); ++i)
+        if (!restored[i])
+            stateParams_[i].param->setValueNotifyingHost(stateParams_[i].param->getDefaultValue());
+
+    ControllerMap map;
+    setControllerMap(reader.readControllerMap(map) ? map : ControllerMap::makeDefault());
+}
+
+// Sessions saved before the binary format: XML via copyXmlToBinary.
+void MIDIControl001AudioProcessor::restoreXmlState(const void* data, int size)
 {
     if (auto xml = getXmlFromBinary(data, size))
     {
         auto vt = juce::ValueTree::fromXml(*xml);
         if (vt.isValid())
+        {
+            // Sessions saved before MIDI learn carry no map: factory CCs.
+            const auto ccTree = vt.getChildWithName(ccMapTag);
+            setControllerMap(ccTree.isValid() ? controllerMapFromTree(ccTree)
+                                              : ControllerMap::makeDefault());
+            vt.removeChild(ccTree, nullptr);
+
             apvts.replaceState(vt);
+        }
     }
 }
 
 juce::AudioProcessorEditor* MIDIControl001AudioProcessor::createEditor()
 {
-    static int editorCount = 0;
-    ++editorCount;
-    DBG("=== createEditor() called! Instance #" << editorCount << " ===");
+    ++editorCount_;
+    DBG("=== createEditor() called! Editor #" << editorCount_ << " of this instance ===");
 
     return new juce::GenericAudioProcessorEditor(*this);
 }
@@ -7,12 +7,18 @@
 // NEW:
 #include "dsp/VoiceManager.h"
 #include "params/ParameterSnapshot.h"
+#include "params/ParameterChangeQueue.h"
+#include "params/StateCodec.h"
 
-class MIDIControl001AudioProcessor : public juce::AudioProcessor
+#include <array>
+#include <atomic>
+
+class MIDIControl001AudioProcessor : public juce::AudioProcessor,
+                                     private juce::Timer
 {
 public:
     MIDIControl001AudioProcessor();
-    ~MIDIControl001AudioProcessor() override = default;
+    ~MIDIControl001AudioProcessor() override { stopTimer(); }
 
     // ============================================================
     // JUCE AudioProcessor overrides
@@ -58,6 +64,50 @@ public:
         voiceManager_.setAudioSynthesisEnabled(enabled);
     }
 
+    // ============================================================
+    // MIDI learn / CC mapping (message thread)
+    // ------------------------------------------------------------
+    // Edits are published to the audio thread without locking and
+    // are saved with the plugin state.
+    // ============================================================
+    ControllerMap getControllerMap() const { return voiceManager_.getPublishedControllerMap(); }
+    void setControllerMap(const ControllerMap& map) { voiceManager_.setControllerMap(map); }
+
+    void learnController(int cc, CcTarget target)
+    {
+        auto map = getControllerMap();
+        map.learn(cc, target);
+        setControllerMap(map);
+    }
+
+    // ============================================================
+    // CC → host parameter hand-off
+    // ------------------------------------------------------------
+    // processBlock() applies CC-driven host parameters to its own DSP
+    // state immediately and queues the host update; the message
+    // thread pushes queued values into APVTS (and so the host) from
+    // a 30 Hz timer, running from prepareToPlay to releaseResources.
+    // Tests / tools without a message loop call this directly.
+    // ============================================================
+    void flushHostParameterChanges();
+
+    // ============================================================
+    // Internal sub-block size (samples)
+    // ------------------------------------------------------------
+    // processBlock() renders in sub-blocks of this length and takes
+    // a fresh parameter snapshot (and applies due MIDI) before each,
+    // so automation resolution does not depend on the host buffer.
+    // ============================================================
+    static constexpr int defaultSubBlockSize = 64;
+    static constexpr int minSubBlockSize     = 8;
+    static constexpr int maxSubBlockSize     = 1024;
+
+    void setSubBlockSize(int samples) noexcept
+    {
+        subBlockSize_.store(juce::jlimit(minSubBlockSize, maxSubBlockSize, samples));
+    }
+    int getSubBlockSize() const noexcept { return subBlockSize_.load(); }
+
     // ============================================================
     // Public Members
     // ============================================================
@@ -69,8 +119,65 @@ private:
     juce::AudioBuffer<float> monoScratch_;
     double sampleRate_ = 44100.0;
 
+    // Host parameter behind each CcTarget (nullptr: engine/voice only)
+    std::array<juce::RangedAudioParameter*, numCcTargets> ccParams_ {};
+
+    // Audio-thread side of the host hand-off (normalised, < 0 = unset):
+    // ccLive_ overrides APVTS until the message thread has applied
+    // the value; hostUnposted_ waits for queue space.
+    ParameterChangeQueue hostChanges_;
+    std::array<float, numCcTargets>    ccLive_ {};
+    std::array<float, numCcTargets>    hostUnposted_ {};
+    std::array<uint32_t, numCcTargets> hostPostedSeq_ {};
+    std::array<std::atomic<uint32_t>, numCcTargets> hostAppliedSeq_ {};
+    uint32_t hostSeq_ = 0;
+
+    void releaseAppliedControllerValues() noexcept;
+    void postHostParameterChanges() noexcept;
+    float hostValue(CcTarget target, float paramValue) const noexcept;
+
+    void timerCallback() override { flushHostParameterChanges(); }
+
     // Small helper to read a snapshot from APVTS
     ParameterSnapshot makeSnapshotFromParams() const;
+    void handleMidiMessage(const juce::MidiMessage& msg);
+
+    // APVTS value atomics behind the snapshot (nullptr: not in layout)
+    struct ParamPointers
+    {
+        std::atomic<float>* masterVolume = nullptr;
+        std::atomic<float>* masterMix    = nullptr;
+        std::atomic<float>* voiceMode    = nullptr;
+        std::atomic<float>* oscType      = nullptr;
+        std::atomic<float>* velCurve     = nullptr;
+        std::atomic<float>* keyTrack     = nullptr;
+        std::atomic<float>* mpeEnabled   = nullptr;
+        std::atomic<float>* oscFreq      = nullptr;
+        std::atomic<float>* envAttack    = nullptr;
+        std::atomic<float>* envRelease   = nullptr;
+        std::atomic<float>* renderThreads = nullptr;
+
+        // [voice][VoiceParamIndex], always registered
+        using Voice = std::array<std::atomic<float>*, numVoiceParams>;
+        std::array<Voice, NUM_VOICES> voices {};
+    } params_;
+
+    std::atomic<int> subBlockSize_ { defaultSubBlockSize };
+
+    // Binary state: every host parameter with its ID bytes, in layout
+    // order (the order state is written in, so restore is one pass).
+    struct StateParam
+    {
+        std::string_view id;
+        juce::RangedAudioParameter* param = nullptr;
+    };
+    std::vector<StateParam> stateParams_;
+
+    int  findStateParam(std::string_view id, size_t& hint) const noexcept;
+    void restoreBinaryState(const void* data, size_t size);
+    void restoreXmlState(const void* data, int size);
+
+    int editorCount_ = 0;   // diagnostics (message thread)
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MIDIControl001AudioProcessor)
 };
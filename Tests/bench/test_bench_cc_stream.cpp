@@ -0,0 +1,76 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "plugin/PluginProcessor.h"
+
+#include <chrono>
+#include <iostream>
+
+// ============================================================
+// Benchmark: audio-thread cost of dense CC streams
+// ------------------------------------------------------------
+// 8 held notes, 4 s of blocks with and without 10 kHz of CC
+// (CC1–5 round robin). The difference is the per-CC cost on the
+// audio thread; the dense run must stay inside the real-time
+// budget. Queued host parameter updates are drained at UI rate,
+// off the timed path.
+//
+// Hidden by default. Run explicitly:
+//   MIDIControl001_tests "[bench]"
+// ============================================================
+
+TEST_CASE("Bench: audio-thread cost of dense CC streams", "[.][bench]")
+{
+    constexpr double sr        = 48000.0;
+    constexpr int    blockSize = 256;
+    constexpr int    numBlocks = 750;   // 4 s
+    constexpr int    ccPerSec  = 10000;
+
+    MIDIControl001AudioProcessor proc;
+    proc.prepareToPlay(sr, blockSize);
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+
+    for (int n = 0; n < 8; ++n)
+        midi.addEvent(juce::MidiMessage::noteOn(1, 60 + n, (juce::uint8) 100), 0);
+    proc.processBlock(buffer, midi);
+
+    const int ccPerBlock = static_cast<int>(ccPerSec * blockSize / sr + 0.5);
+
+    auto runBlocks = [&](bool withControllers)
+    {
+        double ms = 0.0;
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            midi.clear();
+            if (withControllers)
+                for (int m = 0; m < ccPerBlock; ++m)
+                    midi.addEvent(juce::MidiMessage::controllerEvent(1, 1 + m % 5, (b + m) % 128),
+                                  m * blockSize / ccPerBlock);
+
+            const auto t0 = std::chrono::steady_clock::now();
+            proc.processBlock(buffer, midi);
+            const auto t1 = std::chrono::steady_clock::now();
+            ms += std::chrono::duration<double, std::milli>(t1 - t0).count();
+
+            if (b % 6 == 0)
+                proc.flushHostParameterChanges();
+        }
+        return ms;
+    };
+
+    const double quietMs = runBlocks(false);
+    const double denseMs = runBlocks(true);
+
+    const double ccUs     = 1000.0 * (denseMs - quietMs) / (static_cast<double>(numBlocks) * ccPerBlock);
+    const double budgetMs = 1000.0 * numBlocks * blockSize / sr;
+
+    std::cout << "\n[BENCH cc] " << ccPerBlock << " CC/block over " << numBlocks << " blocks"
+              << "\n  quiet=" << quietMs << " ms  dense=" << denseMs << " ms"
+              << "  (~" << ccUs << " us per CC on the audio thread)"
+              << "\n  real-time budget=" << budgetMs << " ms" << std::endl;
+
+    CHECK(denseMs < budgetMs);
+}
@@ -0,0 +1,59 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsp/envelopes/EnvelopeADSR.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// ============================================================
+// Benchmark: retarded-time ADSR lookup, full evaluation vs cursor
+// ------------------------------------------------------------
+// One note's worth of monotone retarded times (attack through the
+// end of the release tail) evaluated with AdsrTimeline::valueAt()
+// and with an AdsrTimeline::Cursor, as VoiceDopp renders them.
+//
+// Hidden by default. Run explicitly:
+//   MIDIControl001_tests "[bench]"
+// ============================================================
+
+TEST_CASE("Bench: ADSR timeline cursor vs full evaluation", "[.][bench]")
+{
+    constexpr double sr      = 48000.0;
+    constexpr int    samples = 48000 * 4;
+    constexpr int    rounds  = 20;
+
+    AdsrTimeline tl;
+    tl.setADSR(0.2, 0.3, 0.6, 1.0);
+    tl.setNoteTimes(0.0, 2.5);
+
+    // Slowly varying propagation delay, as for a moving listener.
+    std::vector<double> tRet(samples);
+    for (int i = 0; i < samples; ++i)
+        tRet[static_cast<size_t>(i)] = i / sr - 0.01 - 0.002 * (i / static_cast<double>(samples));
+
+    double sumFull = 0.0, sumCursor = 0.0;
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; ++r)
+        for (int i = 0; i < samples; ++i)
+            sumFull += tl.valueAt(tRet[static_cast<size_t>(i)]);
+    auto t1 = std::chrono::steady_clock::now();
+
+    for (int r = 0; r < rounds; ++r)
+    {
+        AdsrTimeline::Cursor cursor;
+        for (int i = 0; i < samples; ++i)
+            sumCursor += cursor.valueAt(tl, tRet[static_cast<size_t>(i)]);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    const double fullNs   = std::chrono::duration<double, std::nano>(t1 - t0).count() / (rounds * samples);
+    const double cursorNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / (rounds * samples);
+
+    std::cout << "[BENCH envelope] full=" << fullNs << " ns/sample"
+              << " cursor=" << cursorNs << " ns/sample"
+              << " speedup=" << (fullNs / cursorNs)
+              << " (checksum diff " << (sumFull - sumCursor) << ")\n";
+
+    REQUIRE(std::abs(sumFull - sumCursor) < 1e-6 * rounds * samples);
+}
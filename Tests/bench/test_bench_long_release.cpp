@@ -0,0 +1,82 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsp/VoiceManager.h"
+#include "params/ParameterSnapshot.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// ============================================================
+// Benchmark: render cost across a long release tail
+// ------------------------------------------------------------
+// Sixteen VoiceA notes are released with a 5 s tail and the cost
+// per sample is measured in windows from the start of the release
+// to its last block. With FTZ/DAZ set by VoiceManager::render and
+// no per-sample clamps in the kernels, the deep tail must cost the
+// same as the start of the release (no denormal slow path).
+//
+// Hidden by default. Run explicitly:
+//   MIDIControl001_tests "[bench]"
+// ============================================================
+
+TEST_CASE("Bench: long-release tail has no denormal slow path", "[.][bench]")
+{
+    constexpr double sr         = 48000.0;
+    constexpr int    blockSize  = 256;
+    constexpr int    numNotes   = 16;
+    constexpr float  releaseSec = 5.0f;   // CC4 at full scale
+    constexpr int    numWindows = 8;
+
+    ParameterSnapshot snap;
+    snap.voiceMode  = VoiceMode::VoiceA;
+
+    VoiceManager vm([&] { return snap; });
+    vm.prepare(sr, blockSize);
+
+    // Release comes from the persistent CC cache, which wins over the
+    // snapshot in startBlock().
+    vm.handleController(4, 1.0f);
+    vm.startBlock();
+
+    std::vector<float> block(static_cast<size_t>(blockSize), 0.0f);
+
+    for (int n = 0; n < numNotes; ++n)
+        vm.handleNoteOn(48 + n, 1.0f);
+    for (int b = 0; b < 16; ++b)
+        vm.render(block.data(), blockSize);
+
+    for (int n = 0; n < numNotes; ++n)
+        vm.handleNoteOff(48 + n);
+
+    const int tailBlocks   = static_cast<int>(releaseSec * sr) / blockSize;
+    const int windowBlocks = tailBlocks / numWindows;
+
+    std::vector<double> nsPerSample;
+    for (int w = 0; w < numWindows; ++w)
+    {
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int b = 0; b < windowBlocks; ++b)
+            vm.render(block.data(), blockSize);
+        const auto t1 = std::chrono::steady_clock::now();
+
+        const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        nsPerSample.push_back(ns / (static_cast<double>(windowBlocks) * blockSize));
+    }
+
+    std::cout << "\n=== Long release (" << numNotes << " x VoiceA, "
+              << releaseSec << " s tail) ===\n";
+    for (int w = 0; w < numWindows; ++w)
+        std::cout << "  window " << w << ": " << nsPerSample[static_cast<size_t>(w)] << " ns/sample\n";
+
+    // Deep tail vs release start: a denormal slow path shows up as
+    // a multiple, not a few percent.
+    const double ratio = nsPerSample.back() / nsPerSample.front();
+    std::cout << "  last/first = " << ratio << "\n";
+    CHECK(ratio < 2.0);
+
+    // The tail ends on its computed index: one more block finishes it.
+    for (int b = 0; b < 4; ++b)
+        vm.render(block.data(), blockSize);
+    vm.render(block.data(), blockSize);
+    CHECK(vm.getLastRenderMetrics().activeVoices == 0);
+}
@@ -0,0 +1,95 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "plugin/PluginProcessor.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// ============================================================
+// Benchmark: many processors on parallel host threads
+// ------------------------------------------------------------
+// 64 MIDIControl001AudioProcessor instances, each holding 8 notes,
+// processed block-synchronously by 1 … N worker threads (the way a
+// host spreads tracks over its audio workers). Reports instance
+// blocks per second and speed-up over one thread; with no state
+// shared between instances the scaling should track the core count.
+//
+// Hidden by default. Run explicitly:
+//   MIDIControl001_tests "[bench]"
+// ============================================================
+
+TEST_CASE("Bench: 64 processor instances across threads", "[.][bench]")
+{
+    constexpr int    numInstances = 64;
+    constexpr int    blockSize    = 256;
+    constexpr int    numBlocks    = 200;
+    constexpr double sr           = 48000.0;
+
+    const int maxThreads = std::max(1, std::min(16, static_cast<int>(std::thread::hardware_concurrency())));
+
+    double serialMs = 0.0;
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        std::vector<std::unique_ptr<MIDIControl001AudioProcessor>> session;
+        std::vector<juce::AudioBuffer<float>> buffers;
+
+        for (int i = 0; i < numInstances; ++i)
+        {
+            auto p = std::make_unique<MIDIControl001AudioProcessor>();
+            p->prepareToPlay(sr, blockSize);
+
+            juce::AudioBuffer<float> buffer(2, blockSize);
+            juce::MidiBuffer midi;
+            for (int n = 0; n < 8; ++n)
+                midi.addEvent(juce::MidiMessage::noteOn(1, 40 + (i + n * 5) % 48, (juce::uint8) 100), 0);
+            p->processBlock(buffer, midi);
+
+            session.push_back(std::move(p));
+            buffers.push_back(std::move(buffer));
+        }
+
+        std::vector<juce::MidiBuffer> midis(numInstances);
+
+        const auto t0 = std::chrono::steady_clock::now();
+
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            std::atomic<int> next { 0 };
+            std::vector<std::thread> pool;
+
+            for (int t = 0; t < threads; ++t)
+                pool.emplace_back([&]
+                {
+                    for (int i = next++; i < numInstances; i = next++)
+                        session[static_cast<size_t>(i)]->processBlock(buffers[static_cast<size_t>(i)],
+                                                                      midis[static_cast<size_t>(i)]);
+                });
+
+            for (auto& th : pool)
+                th.join();
+        }
+
+        const auto t1 = std::chrono::steady_clock::now();
+        const double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        if (threads == 1)
+            serialMs = ms;
+
+        const double realtimeMs = 1000.0 * numBlocks * blockSize / sr;
+
+        std::cout << "[BENCH multi-instance] threads=" << threads
+                  << " instances=" << numInstances
+                  << " time=" << ms << " ms"
+                  << " blocks/s=" << (1000.0 * numInstances * numBlocks / ms)
+                  << " speedup=" << (serialMs / ms)
+                  << " rtLoad=" << (100.0 * ms / realtimeMs) << "%\n";
+    }
+
+    SUCCEED();
+}
@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsp/VoiceManager.h"
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// ============================================================
+// Benchmark: parallel voice rendering scaling (1 → N threads)
+// ------------------------------------------------------------
+// Hidden by default. Run explicitly:
+//   MIDIControl001_tests "[bench]"
+// ============================================================
+
+TEST_CASE("Bench: VoiceDopp render scaling across threads", "[.][bench]")
+{
+    constexpr int    blockSize = 256;
+    constexpr int    numBlocks = 400;
+    constexpr double sr        = 48000.0;
+
+    const int maxThreads = std::max(1, std::min(8, static_cast<int>(std::thread::hardware_concurrency())));
+
+    double serialMs = 0.0;
+
+    for (int threads = 1; threads <= maxThreads; ++threads)
+    {
+        VoiceManager vm([] { return ParameterSnapshot{}; });
+        vm.setNumRenderThreads(threads);
+        vm.setParallelThreshold(1);
+        vm.setMode(VoiceMode::VoiceDopp);
+        vm.prepare(sr, blockSize);
+        vm.setAudioSynthesisEnabled(true);
+        vm.startBlock();
+
+        for (int n = 0; n < VoiceManager::maxVoices; ++n)
+            vm.handleNoteOn(36 + n, 1.0f);
+
+        std::vector<float> block(blockSize, 0.0f);
+
+        const auto t0 = std::chrono::steady_clock::now();
+        for (int b = 0; b < numBlocks; ++b)
+            vm.render(block.data(), blockSize);
+        const auto t1 = std::chrono::steady_clock::now();
+
+        const double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+        if (threads == 1)
+            serialMs = ms;
+
+        const double realtimeMs = 1000.0 * numBlocks * blockSize / sr;
+
+        std::cout << "[BENCH parallel] threads=" << threads
+                  << " voices=" << VoiceManager::maxVoices
+                  << " time=" << ms << " ms"
+                  << " speedup=" << (serialMs / ms)
+                  << " rtLoad=" << (100.0 * ms / realtimeMs) << "%\n";
+    }
+
+    SUCCEED();
+}
+
+TEST_CASE("Bench: work-stealing load imbalance with mixed voice costs", "[.][bench]")
+{
+    constexpr int blockSize = 256;
+    constexpr int numBlocks = 400;
+
+    const int threads = std::max(2, std::min(8, static_cast<int>(std::thread::hardware_concurrency())));
+
+    int made = 0;
+    VoiceManager vm([] { return ParameterSnapshot{}; },
+                    [&made](VoiceMode) -> std::unique_ptr<BaseVoice> {
+                        if ((made++ % 4) == 0)
+                            return std::make_unique<VoiceDopp>();
+                        return std::make_unique<VoiceA>();
+                    });
+
+    vm.setNumRenderThreads(threads);
+    vm.setParallelThreshold(1);
+    vm.prepare(48000.0, blockSize);
+    vm.setAudioSynthesisEnabled(true);
+    vm.startBlock();
+
+    for (int n = 0; n < VoiceManager::maxVoices; ++n)
+        vm.handleNoteOn(30 + n, 1.0f);
+
+    std::vector<float> block(blockSize, 0.0f);
+    double imbalanceSum = 0.0;
+    double imbalanceMax = 0.0;
+    long   steals = 0;
+
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        vm.render(block.data(), blockSize);
+        const auto& m = vm.getLastRenderMetrics();
+        imbalanceSum += m.imbalance;
+        imbalanceMax  = std::max(imbalanceMax, m.imbalance);
+        steals       += m.steals;
+    }
+
+    std::cout << "[BENCH stealing] threads=" << threads
+              << " meanImbalance=" << (imbalanceSum / numBlocks)
+              << " maxImbalance=" << imbalanceMax
+              << " stealsPerBlock=" << (static_cast<double>(steals) / numBlocks) << "\n";
+
+    SUCCEED();
+}
@@ -0,0 +1,127 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "dsp/DspTables.h"
+#include "dsp/VoiceManager.h"
+#include "plugin/PluginProcessor.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// ============================================================
+// Benchmark: construction-to-first-block latency
+// ------------------------------------------------------------
+// Table setup is what a host pays per scan/instantiation:
+//   build  — compute every table (no cache; the old behaviour)
+//   mapped — memory-map a valid cache file
+// then VoiceManager construct → prepare → first rendered block
+// with the shared tables already resident, and per-instance
+// processor construct / prepareToPlay (budget: 1 ms each;
+// prepareToPlay includes building the voice pool).
+//
+// Hidden by default. Run explicitly:
+//   MIDIControl001_tests "[bench]"
+// ============================================================
+
+namespace {
+
+template <typename Fn>
+double timeMs(Fn&& fn)
+{
+    const auto t0 = std::chrono::steady_clock::now();
+    fn();
+    const auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+double medianMs(std::vector<double> v)
+{
+    std::sort(v.begin(), v.end());
+    return v[v.size() / 2];
+}
+
+} // namespace
+
+TEST_CASE("Bench: DspTables build vs mapped cache", "[.][bench]")
+{
+    const auto file = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                          .getChildFile("MIDIControl001-dsp-tables-bench.bin");
+    file.deleteFile();
+
+    const double buildMs  = timeMs([] { DspTables t; });
+    const double writeMs  = timeMs([&] { DspTables t(file); });
+    const double mappedMs = timeMs([&] { DspTables t(file); REQUIRE(t.wasLoadedFromCache()); });
+
+    std::cout << "[BENCH startup] tables build=" << buildMs << " ms"
+              << " build+write=" << writeMs << " ms"
+              << " mapped=" << mappedMs << " ms\n";
+
+    file.deleteFile();
+    REQUIRE(mappedMs < buildMs);
+}
+
+TEST_CASE("Bench: VoiceManager construction to first block", "[.][bench]")
+{
+    DspTables::get();   // resident, as after the processor constructor
+
+    for (auto mode : { VoiceMode::VoiceA, VoiceMode::VoiceFM, VoiceMode::VoiceEns, VoiceMode::VoiceDopp })
+    {
+        std::vector<float> block(256, 0.0f);
+
+        const double ms = timeMs([&]
+        {
+            VoiceManager vm([] { return ParameterSnapshot{}; });
+            vm.setNumRenderThreads(1);
+            vm.setMode(mode);
+            vm.prepare(48000.0, 256);
+            vm.startBlock();
+            vm.handleNoteOn(60, 1.0f);
+            vm.render(block.data(), 256);
+        });
+
+        std::cout << "[BENCH startup] mode=" << static_cast<int>(mode)
+                  << " construct→first block=" << ms << " ms\n";
+    }
+
+    SUCCEED();
+}
+
+TEST_CASE("Bench: processor construction and prepare", "[.][bench]")
+{
+    constexpr int numInstances = 50;
+
+    // One-time process setup (shared tables, cache file) is not per-instance.
+    { MIDIControl001AudioProcessor warm; warm.prepareToPlay(48'000.0, 512); }
+
+    std::vector<std::unique_ptr<MIDIControl001AudioProcessor>> procs;
+    std::vector<double> constructMs, prepareMs;
+
+    for (int i = 0; i < numInstances; ++i)
+    {
+        constructMs.push_back(timeMs([&] { procs.push_back(std::make_unique<MIDIControl001AudioProcessor>()); }));
+        prepareMs.push_back(timeMs([&] { procs.back()->prepareToPlay(48'000.0, 512); }));
+    }
+
+    std::cout << "[BENCH startup] processor median construct=" << medianMs(constructMs)
+              << " ms, prepare=" << medianMs(prepareMs) << " ms\n";
+
+    CHECK(medianMs(constructMs) < 1.0);
+    CHECK(medianMs(prepareMs) < 1.0);
+}
+
+TEST_CASE("Bench: VoiceManager prepare", "[.][bench]")
+{
+    std::vector<double> prepareMs;
+
+    for (int i = 0; i < 50; ++i)
+    {
+        VoiceManager vm([] { return ParameterSnapshot{}; });
+        prepareMs.push_back(timeMs([&] { vm.prepare(48000.0, 512); }));
+    }
+
+    std::cout << "[BENCH startup] VoiceManager median prepare=" << medianMs(prepareMs) << " ms\n";
+    CHECK(medianMs(prepareMs) < 1.0);
+}
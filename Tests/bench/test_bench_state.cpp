@@ -0,0 +1,99 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "plugin/PluginProcessor.h"
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// ============================================================
+// Benchmark: plugin state save / restore per instance
+// ------------------------------------------------------------
+//   xml    — the previous path: APVTS copyState → createXml →
+//            copyXmlToBinary, and getXmlFromBinary → fromXml →
+//            replaceState on restore
+//   binary — getStateInformation() / setStateInformation()
+//            (StateCodec)
+// over a session of many instances, repeated to stabilise timing.
+//
+// Hidden by default. Run explicitly:
+//   MIDIControl001_tests "[bench]"
+// ============================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double usSince(Clock::time_point t0)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+}
+
+} // namespace
+
+TEST_CASE("Bench: state save/restore per instance (XML vs binary)", "[.][bench]")
+{
+    constexpr int numInstances = 64;
+    constexpr int rounds       = 20;
+
+    std::vector<std::unique_ptr<MIDIControl001AudioProcessor>> session;
+    for (int i = 0; i < numInstances; ++i)
+    {
+        auto p = std::make_unique<MIDIControl001AudioProcessor>();
+        p->apvts.getParameterAsValue(ParameterIDs::masterVolume).setValue(-1.0f * static_cast<float>(i % 60));
+        p->learnController(20 + i % 100, CcTarget::OscFreq);
+        session.push_back(std::move(p));
+    }
+
+    std::vector<juce::MemoryBlock> xmlBlobs(numInstances), binBlobs(numInstances);
+    double xmlSaveUs = 0.0, binSaveUs = 0.0, xmlLoadUs = 0.0, binLoadUs = 0.0;
+
+    for (int r = 0; r < rounds; ++r)
+    {
+        auto t0 = Clock::now();
+        for (int i = 0; i < numInstances; ++i)
+        {
+            xmlBlobs[static_cast<size_t>(i)].reset();
+            if (auto xml = session[static_cast<size_t>(i)]->apvts.copyState().createXml())
+                juce::AudioProcessor::copyXmlToBinary(*xml, xmlBlobs[static_cast<size_t>(i)]);
+        }
+        xmlSaveUs += usSince(t0);
+
+        t0 = Clock::now();
+        for (int i = 0; i < numInstances; ++i)
+        {
+            binBlobs[static_cast<size_t>(i)].reset();
+            session[static_cast<size_t>(i)]->getStateInformation(binBlobs[static_cast<size_t>(i)]);
+        }
+        binSaveUs += usSince(t0);
+
+        t0 = Clock::now();
+        for (int i = 0; i < numInstances; ++i)
+        {
+            const auto& b = xmlBlobs[static_cast<size_t>(i)];
+            session[static_cast<size_t>(i)]->setStateInformation(b.getData(), static_cast<int>(b.getSize()));
+        }
+        xmlLoadUs += usSince(t0);
+
+        t0 = Clock::now();
+        for (int i = 0; i < numInstances; ++i)
+        {
+            const auto& b = binBlobs[static_cast<size_t>(i)];
+            session[static_cast<size_t>(i)]->setStateInformation(b.getData(), static_cast<int>(b.getSize()));
+        }
+        binLoadUs += usSince(t0);
+    }
+
+    const double per = 1.0 / (numInstances * rounds);
+    std::cout << "[BENCH state] " << numInstances << " instances x " << rounds << " rounds, per instance:"
+              << "\n  xml    save=" << xmlSaveUs * per << " us  restore=" << xmlLoadUs * per << " us"
+              << "  size=" << xmlBlobs[0].getSize() << " B"
+              << "\n  binary save=" << binSaveUs * per << " us  restore=" << binLoadUs * per << " us"
+              << "  size=" << binBlobs[0].getSize() << " B" << std::endl;
+
+    REQUIRE(binBlobs[0].getSize() < xmlBlobs[0].getSize());
+    REQUIRE(binSaveUs < xmlSaveUs);
+    REQUIRE(binLoadUs < xmlLoadUs);
+}
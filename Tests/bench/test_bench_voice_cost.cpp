@@ -0,0 +1,144 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsp/voices/VoiceA.h"
+#include "dsp/voices/VoiceDopp.h"
+#include "dsp/voices/VoiceEns.h"
+#include "dsp/voices/VoiceFM.h"
+#include "dsp/voices/VoiceLET.h"
+#include "params/ParameterSnapshot.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// ============================================================
+// Benchmark: single-voice render cost (ns per sample)
+// ------------------------------------------------------------
+// Hidden by default. Run explicitly:
+//   MIDIControl001_tests "[bench]"
+// ============================================================
+
+namespace {
+
+template <typename Voice>
+double measureNsPerSample(Voice& v, int blockSize, int numBlocks)
+{
+    std::vector<float> block(static_cast<size_t>(blockSize), 0.0f);
+
+    // Warm-up: first-block setup and caches.
+    for (int b = 0; b < 16; ++b)
+        v.render(block.data(), blockSize);
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        std::fill(block.begin(), block.end(), 0.0f);
+        v.render(block.data(), blockSize);
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+    return ns / (static_cast<double>(numBlocks) * blockSize);
+}
+
+template <typename Voice>
+void startDopplerVoice(Voice& v, double sr)
+{
+    v.prepare(sr);
+
+    ParameterSnapshot s;
+    s.oscFreq = 440.0f;
+    v.noteOn(s, 69, 1.0f);
+
+    v.setAudioSynthesisEnabled(true);
+    v.setListenerControls(0.6f, 0.5f);
+}
+
+} // namespace
+
+TEST_CASE("Bench: per-voice render cost (VoiceA / VoiceDopp / VoiceLET)", "[.][bench]")
+{
+    constexpr double sr        = 48000.0;
+    constexpr int    blockSize = 256;
+    constexpr int    numBlocks = 2000;
+
+    VoiceA a;
+    a.prepare(sr);
+    a.noteOn(ParameterSnapshot{}, 69, 1.0f);
+
+    VoiceDopp dopp;
+    startDopplerVoice(dopp, sr);
+
+    VoiceLET let;
+    startDopplerVoice(let, sr);
+
+    const double nsA    = measureNsPerSample(a,    blockSize, numBlocks);
+    const double nsDopp = measureNsPerSample(dopp, blockSize, numBlocks);
+    const double nsLET  = measureNsPerSample(let,  blockSize, numBlocks);
+
+    std::cout << "[BENCH voice] VoiceA="    << nsA    << " ns/sample\n"
+              << "[BENCH voice] VoiceDopp=" << nsDopp << " ns/sample"
+              << " (os=" << dopp.getOversamplingFactor() << "x)\n"
+              << "[BENCH voice] VoiceLET="  << nsLET  << " ns/sample"
+              << " (LET/Dopp=" << (nsLET / nsDopp) << ")\n";
+
+    // Budget: a VoiceLET voice must not cost more than a VoiceDopp voice.
+    REQUIRE(nsLET <= nsDopp * 1.1);
+}
+
+TEST_CASE("Bench: VoiceFM render cost per algorithm", "[.][bench]")
+{
+    constexpr double sr        = 48000.0;
+    constexpr int    blockSize = 256;
+    constexpr int    numBlocks = 2000;
+
+    ParameterSnapshot s;
+    s.envRelease = 5.0f;   // keep the note sounding for the whole run
+
+    for (int a = 0; a < VoiceFM::numAlgorithms; ++a)
+    {
+        VoiceFM fm;
+        fm.prepare(sr);
+        fm.setAlgorithm(static_cast<FMAlgorithm>(a));
+        fm.setFeedback(0.3f);
+        fm.noteOn(s, 57, 1.0f);
+
+        const double ns = measureNsPerSample(fm, blockSize, numBlocks);
+
+        std::cout << "[BENCH fm] algorithm=" << a
+                  << " " << ns << " ns/sample"
+                  << " (" << (ns / VoiceFM::numOps) << " ns/op)\n";
+    }
+
+    SUCCEED();
+}
+
+TEST_CASE("Bench: VoiceEns render cost per band count", "[.][bench]")
+{
+    constexpr double sr        = 48000.0;
+    constexpr int    blockSize = 256;
+    constexpr int    numBlocks = 1000;
+
+    // Per-voice budget: half of one core at this sample rate.
+    const double budgetNsPerSample = 0.5 * 1.0e9 / sr;
+
+    ParameterSnapshot s;
+    s.envRelease = 5.0f;
+
+    for (int bands = VoiceEns::minBands; bands <= VoiceEns::maxBands; bands += 16)
+    {
+        VoiceEns ens;
+        ens.setNumBands(bands);
+        ens.prepare(sr);
+        ens.noteOn(s, 45, 1.0f);
+
+        const double ns = measureNsPerSample(ens, blockSize, numBlocks);
+
+        std::cout << "[BENCH ens] bands=" << bands
+                  << " " << ns << " ns/sample"
+                  << " (" << (ns / bands) << " ns/band)"
+                  << " fits=" << static_cast<int>(budgetNsPerSample / ns) << " voices"
+                  << " limit=" << VoiceEns::polyphonyLimit(bands) << "\n";
+    }
+
+    SUCCEED();
+}
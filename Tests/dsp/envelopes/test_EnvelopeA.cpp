@@ -27,3 +27,55 @@ TEST_CASE("EnvelopeA basic attack-release behavior", "[envelope]") {
 
     REQUIRE_FALSE(env.isActive());
 }
+
+TEST_CASE("EnvelopeA release ends at its computed sample index", "[envelope]") {
+    EnvelopeA env;
+    env.prepare(48000.0);
+    env.setAttack(0.001f);
+    env.setRelease(0.5f);
+
+    env.noteOn();
+    for (int i = 0; i < 100; ++i)
+        env.nextSample();
+    REQUIRE(env.samplesUntilIdle() == EnvelopeA::unbounded);
+
+    env.noteOff();
+    const uint64_t predicted = env.samplesUntilIdle();
+    REQUIRE(predicted > 0);
+    REQUIRE(predicted <= static_cast<uint64_t>(0.5 * 48000.0));
+
+    uint64_t rendered = 0;
+    while (env.isActive())
+    {
+        env.nextSample();
+        ++rendered;
+        REQUIRE(env.samplesUntilIdle() == predicted - rendered);
+    }
+
+    REQUIRE(rendered == predicted);
+    REQUIRE(env.getCurrentValue() == 0.0f);
+}
+
+TEST_CASE("EnvelopeA release-time change mid-tail moves the end", "[envelope]") {
+    EnvelopeA env;
+    env.prepare(48000.0);
+    env.setAttack(0.0f);
+    env.setRelease(2.0f);
+
+    env.noteOn();
+    env.nextSample();
+    env.noteOff();
+    for (int i = 0; i < 1000; ++i)
+        env.nextSample();
+
+    const uint64_t before = env.samplesUntilIdle();
+    env.setRelease(0.1f);
+    const uint64_t after = env.samplesUntilIdle();
+
+    REQUIRE(after < before);
+    REQUIRE(after <= static_cast<uint64_t>(0.1 * 48000.0));
+
+    for (uint64_t i = 0; i < after; ++i)
+        env.nextSample();
+    REQUIRE_FALSE(env.isActive());
+}
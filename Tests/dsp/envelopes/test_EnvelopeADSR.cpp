@@ -0,0 +1,413 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/envelopes/EnvelopeA.h"
+#include "dsp/envelopes/EnvelopeADSR.h"
+#include "dsp/voices/VoiceDopp.h"
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+// ============================================================
+// Shared ADSR engine vs the implementations it replaced
+// ============================================================
+
+namespace {
+
+// The attack/sustain/release EnvelopeA as it was before the shared
+// engine (per-sample state machine), minus diagnostics.
+struct ReferenceEnvelopeA
+{
+    enum class State { Idle, Attack, Sustain, Release };
+    State    state = State::Idle;
+    double   sampleRate = 44100.0, level = 0.0, attackInc = 0.0, releaseCoef = 0.0;
+    double   releaseSeconds = 0.2;
+    uint64_t releaseSamples = 0, releaseEndSample = 0;
+
+    void prepare(double sr) { sampleRate = sr; setAttack(0.01f); setRelease(0.2f); }
+    void setAttack(float s) { attackInc = (s > 0.0f) ? (1.0 / (s * sampleRate)) : 1.0; }
+
+    void setRelease(float s)
+    {
+        releaseSeconds = std::max(0.0f, s);
+        releaseCoef = releaseSeconds == 0.0 ? 0.0 : std::exp(std::log(1e-5) / (releaseSeconds * sampleRate));
+        if (state == State::Release)
+            computeReleaseEnd();
+    }
+
+    void computeReleaseEnd()
+    {
+        const auto nominalEnd = static_cast<uint64_t>(releaseSeconds * sampleRate);
+        uint64_t levelEnd = releaseSamples + 1;
+        if (releaseCoef > 0.0 && releaseCoef < 1.0 && level > 1e-5)
+        {
+            const double n = std::ceil(std::log(1e-5 / level) / std::log(releaseCoef));
+            levelEnd = releaseSamples + static_cast<uint64_t>(std::max(1.0, n));
+        }
+        releaseEndSample = std::max(releaseSamples + 1, std::min(levelEnd, nominalEnd));
+    }
+
+    void noteOn() { state = State::Attack; level = 0.0; releaseSamples = 0; }
+
+    void noteOff()
+    {
+        if (state != State::Idle && state != State::Release)
+        {
+            state = State::Release;
+            releaseSamples = 0;
+            computeReleaseEnd();
+        }
+    }
+
+    float nextSample()
+    {
+        switch (state)
+        {
+            case State::Attack:
+                level += attackInc;
+                if (level >= 1.0) { level = 1.0; state = State::Sustain; }
+                break;
+            case State::Release:
+                ++releaseSamples;
+                level *= releaseCoef;
+                if (releaseSamples >= releaseEndSample) { level = 0.0; state = State::Idle; }
+                break;
+            default:
+                break;
+        }
+        return static_cast<float>(level);
+    }
+};
+
+// VoiceDopp::evalAdsrAtRetardedTime() as it was (branches and
+// divisions per call).
+double referenceAdsr(double tRet, double tOn, double tOff,
+                     double attack, double decay, double sustain, double release)
+{
+    const double t = tRet - tOn;
+    if (t <= 0.0)
+        return 0.0;
+
+    const double attackEnd = attack;
+    const double decayEnd  = attack + decay;
+    const bool hasRelease  = std::isfinite(tOff) && release > 0.0;
+    const double tReleaseStart = hasRelease ? (tOff - tOn) : std::numeric_limits<double>::infinity();
+
+    auto held = [&](double x)
+    {
+        if (attack > 0.0 && x < attackEnd) return x / attack;
+        if (decay > 0.0 && x < decayEnd)   return 1.0 + (sustain - 1.0) * ((x - attackEnd) / decay);
+        return sustain;
+    };
+
+    if (!hasRelease || t <= tReleaseStart)
+        return held(t);
+
+    const double tRel = t - tReleaseStart;
+    if (tRel >= release)
+        return 0.0;
+
+    const double start = tReleaseStart <= 0.0 ? 0.0 : held(tReleaseStart);
+    return std::max(0.0, start * (1.0 - tRel / release));
+}
+
+} // namespace
+
+TEST_CASE("EnvelopeA: shared engine matches the original envelope sample for sample", "[envelope][adsr]")
+{
+    struct Case { float attack, release; int noteOffAt, releaseChangeAt; float newRelease; };
+    const Case cases[] = {
+        { 0.01f,  0.2f,  2000, -1,   0.0f  },
+        { 0.0f,   0.05f,   10, -1,   0.0f  },   // instant attack
+        { 0.05f,  0.5f,   600, -1,   0.0f  },   // released mid-attack
+        { 0.002f, 2.0f,   300, 2000, 0.1f  },   // release shortened mid-tail
+        { 0.02f,  0.0f,  1500, -1,   0.0f  },   // zero release
+    };
+
+    for (const auto& c : cases)
+    {
+        ReferenceEnvelopeA ref;
+        EnvelopeA perSample, block;
+
+        ref.prepare(48000.0);
+        perSample.prepare(48000.0);
+        block.prepare(48000.0);
+
+        ref.setAttack(c.attack);        ref.setRelease(c.release);
+        perSample.setAttack(c.attack);  perSample.setRelease(c.release);
+        block.setAttack(c.attack);      block.setRelease(c.release);
+
+        ref.noteOn(); perSample.noteOn(); block.noteOn();
+
+        constexpr int total = 48000;
+        std::vector<float> expected, gotSample, gotBlock(total);
+
+        for (int i = 0; i < total; ++i)
+        {
+            if (i == c.noteOffAt)       { ref.noteOff(); perSample.noteOff(); }
+            if (i == c.releaseChangeAt) { ref.setRelease(c.newRelease); perSample.setRelease(c.newRelease); }
+            expected.push_back(ref.nextSample());
+            gotSample.push_back(perSample.nextSample());
+        }
+
+        // Block path: odd block sizes, events on block boundaries.
+        for (int i = 0; i < total;)
+        {
+            if (i == c.noteOffAt)       block.noteOff();
+            if (i == c.releaseChangeAt) block.setRelease(c.newRelease);
+
+            int n = 1 + (i * 7) % 97;
+            for (int e : { c.noteOffAt, c.releaseChangeAt })
+                if (e > i && e < i + n) n = e - i;
+            n = std::min(n, total - i);
+
+            block.renderBlock(gotBlock.data() + i, n);
+            i += n;
+        }
+
+        REQUIRE(gotSample == expected);
+        REQUIRE(gotBlock == expected);
+        REQUIRE(perSample.isActive() == (ref.state != ReferenceEnvelopeA::State::Idle));
+    }
+}
+
+TEST_CASE("AdsrTimeline / VoiceDopp: analytic ADSR matches the original evaluation", "[envelope][adsr][dopp]")
+{
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<double> seg(0.0, 0.5), lvl(0.0, 1.0), when(-0.2, 2.0);
+
+    VoiceDopp v;
+    v.prepare(48000.0);
+
+    double worst = 0.0;
+
+    for (int trial = 0; trial < 400; ++trial)
+    {
+        // Some segments absent (0) to cover every branch.
+        const double a = trial % 5 == 0 ? 0.0 : seg(rng);
+        const double d = trial % 7 == 0 ? 0.0 : seg(rng);
+        const double s = lvl(rng);
+        const double r = trial % 11 == 0 ? 0.0 : seg(rng);
+
+        const double tOn  = when(rng);
+        const double tOff = trial % 3 == 0 ? std::numeric_limits<double>::infinity()
+                                           : tOn + when(rng);
+
+        v.setAdsrParamsForTest(a, d, s, r);
+        v.setAdsrTimesForTest(tOn, tOff);
+
+        for (int k = 0; k < 200; ++k)
+        {
+            const double t = tOn - 0.1 + 0.0137 * k;
+            const double diff = std::abs(v.evalAdsrAtRetardedTime(t) - referenceAdsr(t, tOn, tOff, a, d, s, r));
+            worst = std::max(worst, diff);
+        }
+    }
+
+    REQUIRE(worst < 1e-12);
+}
+
+TEST_CASE("EnvelopeA: decay and sustain follow the shared shape", "[envelope][adsr]")
+{
+    constexpr double sr = 48000.0;
+
+    EnvelopeA env;
+    env.prepare(sr);
+    env.setAttack(0.01f);
+    env.setDecay(0.05f);
+    env.setSustain(0.4f);
+    env.setRelease(0.1f);
+    env.noteOn();
+
+    // Stateful samples sit on the analytic curve (sample n is at t = n / sr).
+    const auto& shape = env.getShape();
+    double worst = 0.0;
+    for (int n = 1; n <= 4800; ++n)
+        worst = std::max(worst, std::abs(env.nextSample() - shape.heldLevelAt(n / sr)));
+
+    REQUIRE(worst < 1e-4);
+    REQUIRE(env.getCurrentValue() == Approx(0.4f));
+
+    env.noteOff();
+    while (env.isActive())
+        env.nextSample();
+    REQUIRE(env.getCurrentValue() == 0.0f);
+}
+
+TEST_CASE("EnvelopeA / AdsrTimeline: both releases start from the same held level", "[envelope][adsr]")
+{
+    constexpr double sr = 48000.0;
+    constexpr int noteOffAt = 2400;   // mid-decay
+
+    EnvelopeA env;
+    env.prepare(sr);
+    env.setAttack(0.01f);
+    env.setDecay(0.1f);
+    env.setSustain(0.4f);
+    env.setRelease(0.1f);
+    env.noteOn();
+
+    for (int n = 0; n < noteOffAt; ++n)
+        env.nextSample();
+
+    AdsrTimeline tl;
+    tl.setShape(env.getShape());
+    tl.setNoteTimes(0.0, noteOffAt / sr);
+
+    const double startA = env.getCurrentValue();
+    const double startB = tl.getReleaseStartLevel();
+    REQUIRE(startA == Approx(startB).margin(1e-4));
+    REQUIRE(startB > 0.4);
+
+    // EnvelopeA: geometric from its start level (documented in
+    // EnvelopeADSR.h). AdsrTimeline: the shape's linear release.
+    env.noteOff();
+    const double R    = env.getShape().releaseSec;
+    const double coef = env.getReleaseCoef();
+    const auto   tail = static_cast<int>(R * sr);
+
+    double worstA = 0.0, worstB = 0.0;
+    double prevA = startA, prevB = startB;
+    int n = 1;
+
+    for (; env.isActive(); ++n)
+    {
+        const double a = env.nextSample();
+        const double b = tl.valueAt((noteOffAt + n) / sr);
+
+        if (env.isActive())
+            worstA = std::max(worstA, std::abs(a - startA * std::pow(coef, n)));
+        worstB = std::max(worstB, std::abs(b - startB * (1.0 - n / (R * sr))));
+
+        REQUIRE(a <= prevA);
+        REQUIRE(b <= prevB);
+        prevA = a;
+        prevB = b;
+    }
+
+    REQUIRE(worstA < 1e-6);
+    REQUIRE(worstB < 1e-9);
+
+    // Both are silent by releaseSec.
+    REQUIRE(n - 1 <= tail);
+    REQUIRE(env.getCurrentValue() == 0.0f);
+    REQUIRE(tl.valueAt((noteOffAt + tail) / sr) == Approx(0.0).margin(1e-6));
+}
+
+TEST_CASE("EnvelopeCurves: shapes span 0 → 1 monotonically", "[envelope][adsr]")
+{
+    for (auto curve : { EnvelopeCurve::Linear, EnvelopeCurve::Convex, EnvelopeCurve::Concave })
+    {
+        REQUIRE(EnvelopeCurves::shape(curve, 0.0) == Approx(0.0).margin(1e-12));
+        REQUIRE(EnvelopeCurves::shape(curve, 1.0) == Approx(1.0));
+
+        double prev = -1.0;
+        for (int i = 0; i <= 1000; ++i)
+        {
+            const double y = EnvelopeCurves::shape(curve, i / 1000.0);
+            REQUIRE(y >= prev);
+            prev = y;
+        }
+    }
+
+    // Convex leads, concave lags the linear ramp.
+    REQUIRE(EnvelopeCurves::shape(EnvelopeCurve::Convex, 0.25) > 0.25);
+    REQUIRE(EnvelopeCurves::shape(EnvelopeCurve::Concave, 0.25) < 0.25);
+
+    // A convex attack reaches its peak on the same sample as a linear one.
+    EnvelopeA lin, cvx;
+    lin.prepare(1000.0); cvx.prepare(1000.0);
+    lin.setAttack(0.02f); cvx.setAttack(0.02f);
+    cvx.setCurves(EnvelopeCurve::Convex, EnvelopeCurve::Linear);
+    lin.noteOn(); cvx.noteOn();
+
+    for (int i = 0; i < 10; ++i)
+        REQUIRE(cvx.nextSample() >= lin.nextSample());
+    for (int i = 0; i < 10; ++i) { lin.nextSample(); cvx.nextSample(); }
+    REQUIRE(lin.getCurrentValue() == 1.0f);
+    REQUIRE(cvx.getCurrentValue() == 1.0f);
+}
+
+TEST_CASE("AdsrTimeline::Cursor: matches the original evaluation along monotone and jumping times", "[envelope][adsr][cursor]")
+{
+    std::mt19937 rng(99);
+    std::uniform_real_distribution<double> seg(0.0, 0.3), lvl(0.0, 1.0), when(-0.1, 1.0), jitter(-2e-3, 2e-3);
+
+    double worst = 0.0;
+
+    for (int trial = 0; trial < 300; ++trial)
+    {
+        const double a = trial % 5 == 0 ? 0.0 : seg(rng);
+        const double d = trial % 7 == 0 ? 0.0 : seg(rng);
+        const double s = lvl(rng);
+        const double r = trial % 11 == 0 ? 0.0 : seg(rng);
+
+        const double tOn  = when(rng);
+        const double tOff = trial % 3 == 0 ? AdsrTimeline::never : tOn + when(rng);
+
+        AdsrTimeline tl;
+        tl.setADSR(a, d, s, r);
+        tl.setNoteTimes(tOn, tOff);
+
+        AdsrTimeline::Cursor cursor;
+
+        // A block-like sweep at 48 kHz: mostly monotone, with the
+        // occasional small step back (retarded time under supersonic
+        // motion, or oversampler priming).
+        double t = tOn - 0.01;
+        for (int k = 0; k < 60000; ++k)
+        {
+            t += 1.0 / 48000.0;
+            const double q = (k % 997 == 0) ? t + jitter(rng) : t;
+
+            const double expected = referenceAdsr(q, tOn, tOff, a, d, s, r);
+            worst = std::max(worst, std::abs(cursor.valueAt(tl, q) - expected));
+        }
+    }
+
+    REQUIRE(worst < 1e-9);
+}
+
+TEST_CASE("AdsrTimeline::Cursor: walks forward, restarts on a backward jump or a change", "[envelope][adsr][cursor]")
+{
+    AdsrTimeline tl;
+    tl.setADSR(0.1, 0.1, 0.5, 0.2);
+    tl.setNoteTimes(0.0, 0.5);
+
+    AdsrTimeline::Cursor c;
+
+    REQUIRE(c.valueAt(tl, -1.0) == 0.0);
+    REQUIRE(c.getSegment() == 0);                              // before note-on
+
+    REQUIRE(c.valueAt(tl, 0.05) == Approx(0.5));
+    REQUIRE(c.getSegment() == 1);                              // attack
+    REQUIRE(c.valueAt(tl, 0.15) == Approx(0.75));
+    REQUIRE(c.getSegment() == 2);                              // decay
+    REQUIRE(c.valueAt(tl, 0.3) == Approx(0.5));
+    REQUIRE(c.getSegment() == 3);                              // sustain
+    REQUIRE(c.valueAt(tl, 0.6) == Approx(0.25));
+    REQUIRE(c.getSegment() == 4);                              // release
+    REQUIRE(c.valueAt(tl, 0.8) == 0.0);
+    REQUIRE(c.getSegment() == 5);                              // after the tail
+
+    // Backward: full re-scan lands in the right segment.
+    REQUIRE(c.valueAt(tl, 0.05) == Approx(0.5));
+    REQUIRE(c.getSegment() == 1);
+
+    // A timeline change (new note-off) is picked up mid-walk.
+    tl.setNoteTimes(0.0, 0.06);
+    REQUIRE(c.valueAt(tl, 0.16) == Approx(tl.getReleaseStartLevel() * 0.5));
+    REQUIRE(c.getSegment() == 4);
+
+    // Curved segments evaluate through the shape.
+    AdsrShape curved;
+    curved.set(0.1, 0.1, 0.5, 0.2);
+    curved.attackCurve = EnvelopeCurve::Convex;
+    tl.setShape(curved);
+    tl.setNoteTimes(0.0, AdsrTimeline::never);
+    REQUIRE(c.valueAt(tl, 0.025) == Approx(EnvelopeCurves::shape(EnvelopeCurve::Convex, 0.25)));
+}
@@ -0,0 +1,149 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/oscillators/OscillatorWT.h"
+#include "dsp/oscillators/WavetableSet.h"
+#include "dsp/voices/VoiceA.h"
+#include "params/ParameterSnapshot.h"
+#include "utils/dsp_metrics.h"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// OscillatorWT / WavetableSet — shared tables, mip selection,
+// aliasing and VoiceA oscType wiring
+// ============================================================
+
+namespace {
+
+constexpr double kSr = 48000.0;
+
+std::vector<float> renderWT(OscType shape, float hz, int n)
+{
+    OscillatorWT osc;
+    osc.prepare(kSr);
+    osc.setShape(shape);
+    osc.setFrequency(hz);
+
+    std::vector<float> out(static_cast<size_t>(n));
+    for (auto& x : out)
+        x = osc.nextSample();
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("WavetableSet tables are shared and 64-byte aligned", "[oscillator][wt]")
+{
+    const auto& a = WavetableSet::get(OscType::Saw);
+    const auto& b = WavetableSet::get(OscType::Saw);
+    REQUIRE(&a == &b);
+    REQUIRE(&a != &WavetableSet::get(OscType::Square));
+
+    for (int m = 0; m < WavetableSet::numMips; ++m)
+    {
+        const auto addr = reinterpret_cast<std::uintptr_t>(a.row(m) - WavetableSet::guardPre);
+        REQUIRE(addr % 64 == 0);
+    }
+}
+
+TEST_CASE("OscillatorWT picks a mip whose top harmonic stays below Nyquist", "[oscillator][wt]")
+{
+    OscillatorWT osc;
+    osc.prepare(kSr);
+
+    for (float hz = 20.0f; hz < 20000.0f; hz *= 1.07f)
+    {
+        osc.setFrequency(hz);
+        const int m = osc.getMipLevel();
+        INFO("hz " << hz << " mip " << m);
+        REQUIRE(m >= 0);
+        REQUIRE(m < WavetableSet::numMips);
+        REQUIRE(static_cast<double>(WavetableSet::maxHarmonic(m)) * hz < 0.5 * kSr);
+    }
+}
+
+TEST_CASE("OscillatorWT saw is alias-free across the range", "[oscillator][wt]")
+{
+    for (float hz : { 1000.0f, 5000.0f, 12000.0f })
+    {
+        const auto out = renderWT(OscType::Saw, hz, 32768);
+
+        std::vector<double> partials;
+        for (int h = 1; h * hz < 0.5 * kSr; ++h)
+            partials.push_back(h * static_cast<double>(hz));
+
+        const double ratio = aliasingRatioDb(out, kSr, partials, 40.0);
+        INFO("hz " << hz << " alias ratio " << ratio << " dB");
+        REQUIRE(ratio < -50.0);
+    }
+}
+
+TEST_CASE("OscillatorWT sine shape matches std::sin", "[oscillator][wt]")
+{
+    const auto out = renderWT(OscType::Sine, 440.0f, 4800);
+
+    double maxErr = 0.0;
+    for (size_t n = 0; n < out.size(); ++n)
+    {
+        const double ref = std::sin(2.0 * M_PI * 440.0 * static_cast<double>(n) / kSr);
+        maxErr = std::max(maxErr, std::abs(ref - out[n]));
+    }
+    REQUIRE(maxErr < 1.0e-4);
+}
+
+TEST_CASE("OscillatorWT mip crossfade has no jump at octave edges", "[oscillator][wt]")
+{
+    // Just below and just above an octave boundary the output must
+    // be nearly identical: fade → 1 on the low mip equals the next
+    // mip at fade 0.
+    OscillatorWT lo, hi;
+    lo.prepare(kSr);
+    hi.prepare(kSr);
+    lo.setShape(OscType::Square);
+    hi.setShape(OscType::Square);
+
+    const float edge = static_cast<float>(kSr / WavetableSet::tableSize * 4.0);   // level = 3
+    lo.setFrequency(edge * 0.9999f);
+    hi.setFrequency(edge * 1.0001f);
+    REQUIRE(lo.getMipLevel() + 1 == hi.getMipLevel());
+    REQUIRE(lo.getMipCrossfade() > 0.99f);
+    REQUIRE(hi.getMipCrossfade() < 0.01f);
+
+    double maxDiff = 0.0;
+    for (int n = 0; n < 64; ++n)
+        maxDiff = std::max(maxDiff, static_cast<double>(std::fabs(lo.nextSample() - hi.nextSample())));
+    REQUIRE(maxDiff < 0.02);
+}
+
+TEST_CASE("VoiceA renders the snapshot's oscType", "[oscillator][wt]")
+{
+    REQUIRE(toOscType(1) == OscType::Saw);
+    REQUIRE(toOscType(9) == OscType::Sine);
+
+    auto renderVoice = [](OscType type)
+    {
+        VoiceA v;
+        v.prepare(kSr);
+        ParameterSnapshot s;
+        s.oscType = type;
+        v.noteOn(s, 57, 1.0f);   // 220 Hz
+        REQUIRE(v.getOscType() == type);
+
+        std::vector<float> out(16384, 0.0f);
+        for (size_t pos = 0; pos < out.size(); pos += 256)
+            v.render(out.data() + pos, 256);
+        return computePowerSpectrum(std::vector<float>(out.begin() + 4096, out.end()));
+    };
+
+    const auto sine = renderVoice(OscType::Sine);
+    const auto saw  = renderVoice(OscType::Saw);
+
+    const double sineH2 = bandEnergy(sine, kSr, 430.0, 450.0) / bandEnergy(sine, kSr, 210.0, 230.0);
+    const double sawH2  = bandEnergy(saw,  kSr, 430.0, 450.0) / bandEnergy(saw,  kSr, 210.0, 230.0);
+
+    REQUIRE(sineH2 < 1.0e-3);
+    REQUIRE(sawH2 > 0.1);   // 1/h² ≈ 0.25
+}
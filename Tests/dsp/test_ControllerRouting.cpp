@@ -0,0 +1,195 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/ControllerRouting.h"
+#include "dsp/VoiceManager.h"
+#include "dsp/voices/VoiceA.h"
+#include "params/ParameterSnapshot.h"
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// ============================================================
+// ControllerMap / ControllerMapExchange
+// ============================================================
+
+TEST_CASE("ControllerMap: factory routes and MIDI learn", "[cc][map]")
+{
+    auto map = ControllerMap::makeDefault();
+
+    REQUIRE(map.route(1).target == CcTarget::MasterVolume);
+    REQUIRE(map.route(3).target == CcTarget::EnvAttack);
+    REQUIRE(map.route(8).target == CcTarget::VoiceControl8);
+    REQUIRE(map.route(64).target == CcTarget::None);
+
+    // Learning CC21 for attack releases CC3.
+    map.learn(21, CcTarget::EnvAttack);
+    REQUIRE(map.route(21).target == CcTarget::EnvAttack);
+    REQUIRE(map.route(3).target == CcTarget::None);
+    REQUIRE(map.controllerFor(CcTarget::EnvAttack) == 21);
+
+    map.clearRoute(21);
+    REQUIRE(map.controllerFor(CcTarget::EnvAttack) == -1);
+
+    // Out-of-range controllers are ignored.
+    const auto before = map;
+    map.learn(128, CcTarget::OscFreq);
+    map.setRoute(-1, CcRoute { CcTarget::OscFreq });
+    REQUIRE(map == before);
+}
+
+TEST_CASE("ControllerMap: curve and range shaping", "[cc][map]")
+{
+    CcRoute r { CcTarget::MasterMix };
+    REQUIRE(r.shape(0.25f) == Approx(0.25f));
+    REQUIRE(r.shape(-1.0f) == Approx(0.0f));
+    REQUIRE(r.shape(2.0f)  == Approx(1.0f));
+
+    r.curve = CcCurve::Squared;
+    REQUIRE(r.shape(0.5f) == Approx(0.25f));
+
+    r.curve = CcCurve::Root;
+    REQUIRE(r.shape(0.25f) == Approx(0.5f));
+
+    // Inverted sub-range
+    r = CcRoute { CcTarget::MasterMix, CcCurve::Linear, 0.8f, 0.2f };
+    REQUIRE(r.shape(0.0f) == Approx(0.8f));
+    REQUIRE(r.shape(1.0f) == Approx(0.2f));
+
+    // Names round-trip for state serialisation.
+    for (int t = 0; t < numCcTargets; ++t)
+    {
+        CcTarget back = CcTarget::None;
+        REQUIRE(findCcTarget(ccTargetName(static_cast<CcTarget>(t)), back));
+        REQUIRE(back == static_cast<CcTarget>(t));
+    }
+    for (int c = 0; c < numCcCurves; ++c)
+    {
+        CcCurve back = CcCurve::Linear;
+        REQUIRE(findCcCurve(ccCurveName(static_cast<CcCurve>(c)), back));
+        REQUIRE(back == static_cast<CcCurve>(c));
+    }
+}
+
+TEST_CASE("ControllerMapExchange: published maps reach the reader; old ones are reclaimed", "[cc][map]")
+{
+    ControllerMapExchange ex;
+
+    const ControllerMap* first = &ex.acquire();
+    REQUIRE(first->route(5).target == CcTarget::OscFreq);
+
+    auto edited = ex.current();
+    edited.learn(20, CcTarget::OscFreq);
+    ex.publish(edited);
+
+    // The reader still holds the first node, so it survives.
+    REQUIRE(ex.numNodes() == 2);
+    REQUIRE(first->route(5).target == CcTarget::OscFreq);
+
+    const ControllerMap& second = ex.acquire();
+    REQUIRE(second.route(20).target == CcTarget::OscFreq);
+    REQUIRE(second.route(5).target == CcTarget::None);
+
+    ex.collect();
+    REQUIRE(ex.numNodes() == 1);
+}
+
+TEST_CASE("ControllerMapExchange: concurrent publish and acquire", "[cc][map]")
+{
+    ControllerMapExchange ex;
+    std::atomic<bool> done { false };
+    std::atomic<int>  bad { 0 };
+
+    // Reader: every map it sees has exactly one controller on OscFreq.
+    std::thread reader([&]
+    {
+        while (!done.load())
+        {
+            const auto& m = ex.acquire();
+            int bound = 0;
+            for (int cc = 0; cc < ControllerMap::numControllers; ++cc)
+                bound += m.route(cc).target == CcTarget::OscFreq ? 1 : 0;
+            if (bound != 1)
+                ++bad;
+        }
+    });
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        auto m = ControllerMap::makeDefault();
+        m.learn(10 + (i % 100), CcTarget::OscFreq);
+        ex.publish(m);
+    }
+
+    done = true;
+    reader.join();
+
+    REQUIRE(bad.load() == 0);
+    REQUIRE(ex.numNodes() <= 2);
+}
+
+// ============================================================
+// VoiceManager dispatch through the map
+// ============================================================
+
+namespace {
+
+ParameterSnapshot makeSnap() { return ParameterSnapshot {}; }
+
+struct VoiceAPool
+{
+    std::vector<VoiceA*> voices;
+
+    VoiceManager::VoiceFactory factory()
+    {
+        return [this](VoiceMode) -> std::unique_ptr<BaseVoice> {
+            auto v = std::make_unique<VoiceA>();
+            voices.push_back(v.get());
+            return v;
+        };
+    }
+};
+
+} // namespace
+
+TEST_CASE("VoiceManager: remapped CC drives the voice control; the old CC goes quiet", "[cc][map][voicemanager]")
+{
+    VoiceAPool pool;
+    VoiceManager vm(makeSnap);
+    vm.setVoiceFactory(pool.factory());
+    vm.prepare(48000.0, 256);
+    vm.startBlock();
+    vm.handleNoteOn(69, 1.0f);
+    REQUIRE(!pool.voices.empty());
+
+    auto map = vm.getPublishedControllerMap();
+    map.learn(20, CcTarget::OscFreq);
+    vm.setControllerMap(map);
+
+    // Not adopted until the next block.
+    REQUIRE(vm.getControllerMap().route(20).target == CcTarget::None);
+    vm.startBlock();
+    REQUIRE(vm.getControllerMap().route(20).target == CcTarget::OscFreq);
+
+    std::vector<float> block(256, 0.0f);
+
+    vm.handleController(5, 1.0f);    // no longer mapped
+    vm.render(block.data(), 256);
+    REQUIRE(pool.voices[0]->getDetuneSemis() == Approx(0.0f));
+
+    vm.handleController(20, 1.0f);   // full up: +12 semitones
+    vm.render(block.data(), 256);
+    REQUIRE(pool.voices[0]->getDetuneSemis() == Approx(12.0f));
+
+    // A route's sub-range applies before the voice sees it.
+    map.setRoute(20, CcRoute { CcTarget::OscFreq, CcCurve::Linear, 0.5f, 0.75f });
+    vm.setControllerMap(map);
+    vm.startBlock();
+
+    vm.handleController(20, 1.0f);
+    vm.render(block.data(), 256);
+    REQUIRE(pool.voices[0]->getDetuneSemis() == Approx(6.0f));
+}
@@ -0,0 +1,162 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/DspTables.h"
+#include "dsp/oscillators/SineTable.h"
+#include "dsp/oscillators/WavetableSet.h"
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+
+// ============================================================
+// DspTables — shared registry contents, alignment and the
+// memory-mapped cache file round trip
+// ============================================================
+
+namespace {
+
+bool isAligned(const float* p)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % DspTables::alignment == 0;
+}
+
+juce::File scratchCacheFile()
+{
+    auto f = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                 .getChildFile("MIDIControl001-dsp-tables-test.bin");
+    f.deleteFile();
+    return f;
+}
+
+} // namespace
+
+TEST_CASE("DspTables is one shared instance used by the table views", "[dsp][tables]")
+{
+    const auto& t = DspTables::get();
+    REQUIRE(&t == &DspTables::get());
+
+    REQUIRE(SineTable::table() == t.sine());
+    REQUIRE(WavetableSet::get(OscType::Saw).row(3) == t.wavetableRow(OscType::Saw, 3));
+
+    REQUIRE(isAligned(t.sine()));
+    for (int s = 0; s < DspTables::wtShapes; ++s)
+        for (int m = 0; m < DspTables::wtMips; ++m)
+            REQUIRE(isAligned(t.wavetableRow(static_cast<OscType>(s), m) - DspTables::wtGuardPre));
+}
+
+TEST_CASE("DspTables values match their closed forms", "[dsp][tables]")
+{
+    const auto& t = DspTables::get();
+
+    // Bit-identical to the voices' former per-note pow().
+    for (int n = 0; n < DspTables::numNotes; ++n)
+        REQUIRE(t.noteToHz(n) == 440.0f * std::pow(2.0f, (n - 69) / 12.0f));
+    REQUIRE(t.noteToHz(69) == 440.0f);
+
+    for (float db = -90.0f; db <= 24.0f; db += 0.37f)
+    {
+        INFO("db " << db);
+        REQUIRE(t.dbToGain(db) == Approx(std::pow(10.0f, db / 20.0f)).epsilon(2e-4));
+    }
+    REQUIRE(t.dbToGain(-200.0f) == 0.0f);
+    REQUIRE(t.dbToGain(0.0f) == Approx(1.0f).epsilon(1e-6));
+
+    for (float x = -6.0f; x <= 12.0f; x += 0.113f)
+    {
+        INFO("x " << x);
+        REQUIRE(t.exp2(x) == Approx(std::exp2(x)).epsilon(1e-5));
+    }
+    REQUIRE(t.exp2(3.0f) == 8.0f);
+}
+
+TEST_CASE("DspTables cache file round-trips through a memory map", "[dsp][tables]")
+{
+    const auto file = scratchCacheFile();
+
+    DspTables built(file);
+    REQUIRE_FALSE(built.wasLoadedFromCache());
+    REQUIRE(file.existsAsFile());
+
+    DspTables mapped(file);
+    REQUIRE(mapped.wasLoadedFromCache());
+    REQUIRE(isAligned(mapped.sine()));
+
+    const auto& ref = DspTables::get();
+    for (int i = 0; i <= DspTables::sineSize; ++i)
+        REQUIRE(mapped.sine()[i] == ref.sine()[i]);
+    for (int m = 0; m < DspTables::wtMips; ++m)
+        for (int i = -DspTables::wtGuardPre; i < DspTables::wtSize + DspTables::wtGuardPost; ++i)
+            REQUIRE(mapped.wavetableRow(OscType::Square, m)[i] == ref.wavetableRow(OscType::Square, m)[i]);
+    REQUIRE(mapped.noteToHz(60) == ref.noteToHz(60));
+
+    file.deleteFile();
+}
+
+TEST_CASE("DspTables rebuilds from a corrupt or truncated cache", "[dsp][tables]")
+{
+    const auto file = scratchCacheFile();
+    { DspTables seed(file); }
+
+    SECTION("flipped payload byte")
+    {
+        std::fstream f(file.getFullPathName().toStdString(), std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(4096);
+        f.put('\x7f');
+    }
+
+    SECTION("truncated")
+    {
+        std::ofstream f(file.getFullPathName().toStdString(), std::ios::binary | std::ios::trunc);
+        f << "MCDT";
+    }
+
+    DspTables rebuilt(file);
+    REQUIRE_FALSE(rebuilt.wasLoadedFromCache());
+    REQUIRE(rebuilt.sine()[DspTables::sineSize / 4] == Approx(1.0f));
+
+    // The rebuild rewrote a valid cache.
+    DspTables mapped(file);
+    REQUIRE(mapped.wasLoadedFromCache());
+
+    file.deleteFile();
+}
+
+TEST_CASE("DspTables velocity curves and key tracking", "[dsp][tables][velocity]")
+{
+    const auto& t = DspTables::get();
+
+    // Full velocity is unity on every curve; Fixed ignores velocity.
+    for (int c = 0; c < numVelocityCurves; ++c)
+        REQUIRE(t.velocityGain(static_cast<VelocityCurve>(c), 1.0f) == 1.0f);
+    REQUIRE(t.velocityGain(VelocityCurve::Fixed, 0.1f) == 1.0f);
+
+    // 7-bit steps: v = 64/127
+    const float v = 64.0f / 127.0f;
+    REQUIRE(t.velocityGain(VelocityCurve::Linear, v) == Approx(v));
+    REQUIRE(t.velocityGain(VelocityCurve::Soft,   v) == Approx(std::sqrt(v)));
+    REQUIRE(t.velocityGain(VelocityCurve::Hard,   v) == Approx(v * v));
+
+    // Soft ≥ Linear ≥ Hard, each monotonic
+    float prev[3] = { -1.0f, -1.0f, -1.0f };
+    for (int i = 0; i < 128; ++i)
+    {
+        const float x = static_cast<float>(i) / 127.0f;
+        const float s = t.velocityGain(VelocityCurve::Soft,   x);
+        const float l = t.velocityGain(VelocityCurve::Linear, x);
+        const float h = t.velocityGain(VelocityCurve::Hard,   x);
+
+        REQUIRE(s >= l);
+        REQUIRE(l >= h);
+        REQUIRE(s >= prev[0]);
+        REQUIRE(l >= prev[1]);
+        REQUIRE(h >= prev[2]);
+        prev[0] = s; prev[1] = l; prev[2] = h;
+    }
+
+    // Key tracking pivots on middle C: ±6 dB per octave
+    REQUIRE(t.noteGain(VelocityCurve::Fixed, 1.0f, 60, 6.0f) == 1.0f);
+    REQUIRE(t.noteGain(VelocityCurve::Fixed, 1.0f, 72, 6.0f) == Approx(std::pow(10.0f, 6.0f / 20.0f)).epsilon(1e-4));
+    REQUIRE(t.noteGain(VelocityCurve::Fixed, 1.0f, 48, 6.0f) == Approx(std::pow(10.0f, -6.0f / 20.0f)).epsilon(1e-4));
+    REQUIRE(t.noteGain(VelocityCurve::Linear, 0.5f, 84, 0.0f) == t.velocityGain(VelocityCurve::Linear, 0.5f));
+}
@@ -0,0 +1,130 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsp/VoiceArena.h"
+#include "dsp/VoiceManager.h"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// ============================================================
+// VoiceArena / VoiceManager pool — layout and allocation-free
+// voice churn after prepare()
+// ============================================================
+
+// ------------------------------------------------------------
+// Global allocation counter (whole test binary; only counts
+// while a test has armed it)
+// ------------------------------------------------------------
+namespace {
+
+std::atomic<bool> countingAllocations { false };
+std::atomic<long> allocationCount { 0 };
+
+void* countedAlloc(std::size_t size)
+{
+    if (countingAllocations.load(std::memory_order_relaxed))
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* p = std::malloc(size > 0 ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void* countedAlignedAlloc(std::size_t size, std::align_val_t align)
+{
+    if (countingAllocations.load(std::memory_order_relaxed))
+        allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    const auto a = static_cast<std::size_t>(align);
+    if (void* p = std::aligned_alloc(a, (size + a - 1) / a * a))
+        return p;
+    throw std::bad_alloc();
+}
+
+struct AllocationCounter
+{
+    AllocationCounter()  { allocationCount = 0; countingAllocations = true; }
+    ~AllocationCounter() { countingAllocations = false; }
+    long count() const   { return allocationCount.load(); }
+};
+
+} // namespace
+
+void* operator new(std::size_t n)                               { return countedAlloc(n); }
+void* operator new[](std::size_t n)                             { return countedAlloc(n); }
+void* operator new(std::size_t n, std::align_val_t a)           { return countedAlignedAlloc(n, a); }
+void* operator new[](std::size_t n, std::align_val_t a)         { return countedAlignedAlloc(n, a); }
+void  operator delete(void* p) noexcept                         { std::free(p); }
+void  operator delete[](void* p) noexcept                       { std::free(p); }
+void  operator delete(void* p, std::size_t) noexcept            { std::free(p); }
+void  operator delete[](void* p, std::size_t) noexcept          { std::free(p); }
+void  operator delete(void* p, std::align_val_t) noexcept       { std::free(p); }
+void  operator delete[](void* p, std::align_val_t) noexcept     { std::free(p); }
+void  operator delete(void* p, std::size_t, std::align_val_t) noexcept   { std::free(p); }
+void  operator delete[](void* p, std::size_t, std::align_val_t) noexcept { std::free(p); }
+
+// ------------------------------------------------------------
+
+TEST_CASE("VoiceArena places voices on consecutive cache lines", "[voice][arena]")
+{
+    VoiceArena arena;
+    arena.reserve(4 * VoiceArena::slotBytes<VoiceFM>());
+
+    std::vector<BaseVoice*> voices;
+    while (auto* v = arena.construct<VoiceFM>())
+        voices.push_back(v);
+
+    REQUIRE(voices.size() == 4);
+    REQUIRE(arena.usedBytes() == arena.capacityBytes());
+
+    for (size_t i = 0; i < voices.size(); ++i)
+    {
+        const auto addr = reinterpret_cast<std::uintptr_t>(voices[i]);
+        REQUIRE(addr % VoiceArena::alignment == 0);
+        if (i > 0)
+            REQUIRE(addr - reinterpret_cast<std::uintptr_t>(voices[i - 1]) == VoiceArena::slotBytes<VoiceFM>());
+    }
+
+    arena.clear();
+    REQUIRE(arena.size() == 0);
+    REQUIRE(arena.usedBytes() == 0);
+}
+
+TEST_CASE("VoiceManager makes no global allocations after prepare()", "[voice][arena]")
+{
+    VoiceManager vm([] { return ParameterSnapshot{}; });
+    vm.setNumRenderThreads(3);
+    vm.setParallelThreshold(1);
+    vm.prepare(48000.0, 256);
+
+    std::vector<float> block(256, 0.0f);
+    long allocations = 0;
+
+    {
+        AllocationCounter counter;
+
+        for (auto mode : { VoiceMode::VoiceA, VoiceMode::VoiceFM, VoiceMode::VoiceEns,
+                           VoiceMode::VoiceDopp, VoiceMode::VoiceLET, VoiceMode::VoiceA })
+        {
+            vm.setMode(mode);
+            vm.startBlock();
+
+            vm.handleController(7, 0.5f);
+            for (int n = 0; n < 8; ++n)
+                vm.handleNoteOn(48 + n, 1.0f);
+
+            for (int b = 0; b < 4; ++b)
+                vm.render(block.data(), 256);
+
+            for (int n = 0; n < 8; ++n)
+                vm.handleNoteOff(48 + n);
+            vm.render(block.data(), 256);
+        }
+
+        allocations = counter.count();
+    }
+
+    REQUIRE(allocations == 0);
+}
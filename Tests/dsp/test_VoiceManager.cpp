@@ -48,8 +48,9 @@ TEST_CASE("VoiceManager basic polyphony", "[voicemanager]") {
     mgr.handleNoteOff(60);
     mgr.handleNoteOff(64);
 
-    // let envelopes decay
-    for (int i = 0; i < 4410; ++i) {
+    // let envelopes decay (voices retire at the end of the default
+    // 0.2 s release, not on a level threshold)
+    for (int i = 0; i < 8820; ++i) {
         float tmp[1] = {0.0f};
         mgr.render(tmp, 1);
     }
@@ -88,3 +89,199 @@ TEST_CASE("VoiceManager voice stealing", "[voicemanager]") {
     float limited = pg.process(idle);
     REQUIRE(limited == Approx(idle).margin(0.05f));
 }
+
+TEST_CASE("VoiceManager defers voice construction to the first note", "[voicemanager]") {
+    VoiceManager mgr([] { return ParameterSnapshot{}; });
+    mgr.setNumRenderThreads(1);
+
+    mgr.prepare(48000.0, 512);
+
+    REQUIRE_FALSE(mgr.areVoicesPrepared());
+    REQUIRE(mgr.getNumConstructedVoices() == 0);
+
+    // A controller before any note reaches the voices once built.
+    mgr.startBlock();
+    mgr.handleController(5, 1.0f);   // VoiceA CC5: +1 semitone detune
+    mgr.handleNoteOn(60, 1.0f);
+
+    REQUIRE(mgr.areVoicesPrepared());
+    REQUIRE(mgr.getNumConstructedVoices() == VoiceManager::polyphonyForMode(VoiceMode::VoiceA));
+
+    std::vector<float> buf(256, 0.0f);
+    mgr.render(buf.data(), (int)buf.size());
+    REQUIRE(computeRMS(buf) > 0.0f);
+
+    // Mode change drops the pool; the next note rebuilds it.
+    mgr.setMode(VoiceMode::VoiceEns);
+    mgr.startBlock();
+    REQUIRE(mgr.getNumConstructedVoices() == 0);
+
+    mgr.handleNoteOn(60, 1.0f);
+    REQUIRE(mgr.getNumConstructedVoices() == VoiceManager::polyphonyForMode(VoiceMode::VoiceEns));
+}
+
+TEST_CASE("VoiceManager applies per-voice params until a controller drives the field", "[voicemanager][params]") {
+    std::vector<VoiceDopp*> voices;
+
+    auto makeSnap = [] {
+        ParameterSnapshot s;
+        s.voices[0] = VoiceParams { 330.0f, 0.05f, 0.5f };
+        s.voices[1] = VoiceParams { 550.0f, 0.10f, 1.0f };
+        return s;
+    };
+
+    VoiceManager mgr(makeSnap);
+    mgr.setVoiceFactory([&](VoiceMode) {
+        auto v = std::make_unique<VoiceDopp>();
+        voices.push_back(v.get());
+        return v;
+    });
+    mgr.prepare(48000.0, 256);
+    mgr.prepareVoices();
+    mgr.startBlock();
+
+    REQUIRE(voices.size() >= 3);
+
+    // Each slot hears its own group.
+    REQUIRE(voices[0]->getBaseFrequencyForTest() == Approx(330.0));
+    REQUIRE(voices[0]->getAttackForTest()        == Approx(0.05));
+    REQUIRE(voices[1]->getBaseFrequencyForTest() == Approx(550.0));
+    REQUIRE(voices[1]->getReleaseForTest()       == Approx(1.0));
+    REQUIRE(voices[2]->getAttackForTest()        == Approx(0.01));   // group defaults
+
+    // CC5 (osc/freq) takes over frequency on every voice; the
+    // envelope fields stay per-voice.
+    mgr.handleController(5, 0.75f);
+    mgr.flushControllers();
+    mgr.startBlock();
+
+    const double ccHz = ControllerCurves::oscFreqHz(0.75f);
+    REQUIRE(voices[0]->getBaseFrequencyForTest() == Approx(ccHz));
+    REQUIRE(voices[1]->getBaseFrequencyForTest() == Approx(ccHz));
+    REQUIRE(voices[0]->getAttackForTest()        == Approx(0.05));
+    REQUIRE(voices[1]->getAttackForTest()        == Approx(0.10));
+}
+
+TEST_CASE("VoiceManager startBlock takes a caller-built snapshot", "[voicemanager][params]") {
+    int made = 0;
+    VoiceManager mgr([&made] { ++made; return ParameterSnapshot{}; });
+    mgr.prepare(48000.0, 256);
+
+    ParameterSnapshot snap;
+    snap.masterMix = 0.25f;
+    mgr.startBlock(snap);
+
+    REQUIRE(made == 0);
+    REQUIRE(mgr.getCurrentSnapshot() != nullptr);
+    REQUIRE(mgr.getCurrentSnapshot()->masterMix == Approx(0.25f));
+
+    mgr.startBlock();
+    REQUIRE(made == 1);
+}
+
+TEST_CASE("VoiceManager plays every slot, from note-on, on its voice group", "[voicemanager][params]") {
+    std::vector<VoiceDopp*> voices;
+
+    auto makeSnap = [] {
+        ParameterSnapshot s;
+        s.voices[0] = VoiceParams { 330.0f, 0.05f, 0.5f };
+        s.voices[1] = VoiceParams { 550.0f, 0.10f, 1.0f };
+        s.voices[2] = VoiceParams { 440.0f, 0.20f, 2.0f };
+        return s;
+    };
+
+    VoiceManager mgr(makeSnap);
+    mgr.setVoiceFactory([&](VoiceMode) {
+        auto v = std::make_unique<VoiceDopp>();
+        voices.push_back(v.get());
+        return v;
+    });
+    mgr.prepare(48000.0, 256);
+    mgr.startBlock();
+
+    // More simultaneous notes than groups: slots 0 … 6 in turn.
+    constexpr int numNotes = 7;
+    for (int n = 0; n < numNotes; ++n)
+        mgr.handleNoteOn(69, 1.0f);
+
+    REQUIRE(voices.size() >= static_cast<size_t>(numNotes));
+
+    const auto snap = makeSnap();
+    auto checkSlots = [&] {
+        for (int i = 0; i < numNotes; ++i)
+        {
+            const auto& group = snap.voices[static_cast<size_t>(VoiceManager::voiceGroupForSlot(i))];
+            INFO("slot " << i);
+            REQUIRE(voices[static_cast<size_t>(i)]->isActive());
+            REQUIRE(voices[static_cast<size_t>(i)]->getAttackForTest()        == Approx(group.envAttack));
+            REQUIRE(voices[static_cast<size_t>(i)]->getReleaseForTest()       == Approx(group.envRelease));
+            REQUIRE(voices[static_cast<size_t>(i)]->getBaseFrequencyForTest() == Approx(group.oscFreq));   // A4 reference
+        }
+    };
+
+    // Note-on already uses the group; later blocks don't switch source.
+    checkSlots();
+
+    std::vector<float> buf(256, 0.0f);
+    mgr.render(buf.data(), (int)buf.size());
+    mgr.startBlock();
+    checkSlots();
+}
+
+namespace {
+
+// A held note rendered in 512-sample host blocks, each split into
+// render() calls of at most `subBlock` samples.
+std::vector<float> renderHeldNoteInSubBlocks(int subBlock, int total)
+{
+    VoiceManager mgr([] {
+        ParameterSnapshot s;
+        s.envAttack = 0.001f;
+        return s;
+    });
+    mgr.prepare(48000.0, 512);
+    mgr.setAudioSynthesisEnabled(true);
+    mgr.startBlock();
+    mgr.handleNoteOn(57, 0.5f);
+
+    std::vector<float> out(static_cast<size_t>(total), 0.0f);
+
+    for (int host = 0; host < total; host += 512)
+        for (int start = host; start < std::min(host + 512, total); start += subBlock)
+        {
+            mgr.startBlock();
+            mgr.render(out.data() + start, std::min({ subBlock, host + 512 - start, total - start }));
+        }
+
+    return out;
+}
+
+float rmsOver(const std::vector<float>& x, int from, int to)
+{
+    double sum = 0.0;
+    for (int i = from; i < to; ++i)
+        sum += static_cast<double>(x[static_cast<size_t>(i)]) * x[static_cast<size_t>(i)];
+    return static_cast<float>(std::sqrt(sum / (to - from)));
+}
+
+} // namespace
+
+TEST_CASE("VoiceManager gain control settles at the same rate for any sub-block size", "[voicemanager][agc]") {
+    constexpr int total = 48000 / 4;
+
+    // 100 does not divide the 512-sample host block.
+    const auto whole = renderHeldNoteInSubBlocks(512, total);
+    const auto odd   = renderHeldNoteInSubBlocks(100, total);
+    const auto fine  = renderHeldNoteInSubBlocks(64,  total);
+
+    for (int from : { 1024, 2048, 4096, 8192 })
+    {
+        const float ref = rmsOver(whole, from, from + 1024);
+        INFO("window at " << from << ": 512=" << ref
+             << " 100=" << rmsOver(odd, from, from + 1024)
+             << " 64=" << rmsOver(fine, from, from + 1024));
+        REQUIRE(ref > 0.0f);
+        CHECK(rmsOver(odd,  from, from + 1024) == Approx(ref).epsilon(0.05));
+        CHECK(rmsOver(fine, from, from + 1024) == Approx(ref).epsilon(0.05));
+    }
+}
@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/VoiceManager.h"
+#include "dsp/ControllerRouting.h"
+#include "params/ParameterSnapshot.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// ============================================================
+// CC routing: coalescing, active-only fan-out, 10k CC/s stress
+// ============================================================
+
+namespace {
+
+ParameterSnapshot makeSnap() { return ParameterSnapshot {}; }
+
+} // namespace
+
+TEST_CASE("CC routing: repeated CCs coalesce to the last value", "[voicemanager][cc]")
+{
+    VoiceManager vm(makeSnap);
+    vm.prepare(48000.0, 256);
+    vm.startBlock();
+
+    vm.handleNoteOn(60, 1.0f);
+    vm.handleNoteOn(64, 1.0f);
+
+    for (int i = 0; i <= 100; ++i)
+        vm.handleController(4, static_cast<float>(i) / 100.0f);
+
+    std::vector<float> block(256, 0.0f);
+    vm.render(block.data(), 256);
+
+    const auto& stats = vm.getControllerStats();
+    REQUIRE(stats.received == 101);
+    REQUIRE(stats.applied == 1);
+    REQUIRE(stats.voiceCalls == 2);   // two active voices, once each
+    REQUIRE(vm.getControllerMap().route(4).target == CcTarget::EnvRelease);
+}
+
+TEST_CASE("CC routing: idle voices catch up when they start", "[voicemanager][cc]")
+{
+    VoiceManager vm(makeSnap);
+    vm.prepare(48000.0, 256);
+    vm.startBlock();
+    vm.prepareVoices();
+
+    std::vector<float> block(256, 0.0f);
+
+    // No active voices: nothing is fanned out.
+    vm.handleController(5, 1.0f);
+    vm.render(block.data(), 256);
+    REQUIRE(vm.getControllerStats().voiceCalls == 0);
+
+    // The voice that takes the next note gets CC5 (+12 semitone
+    // detune) before noteOn: A4 plays at 880 Hz.
+    vm.handleNoteOn(69, 1.0f);
+    std::vector<float> longBlock(4800, 0.0f);
+    vm.render(longBlock.data(), 4800);
+
+    int crossings = 0;
+    for (size_t i = 1; i < longBlock.size(); ++i)
+        if ((longBlock[i - 1] < 0.0f) != (longBlock[i] < 0.0f)) ++crossings;
+
+    REQUIRE(crossings == Approx(2 * 88).margin(4));   // 880 Hz × 0.1 s
+}
+
+TEST_CASE("CC routing: unrouted controllers never reach voices", "[voicemanager][cc]")
+{
+    VoiceManager vm(makeSnap);
+    vm.prepare(48000.0, 256);
+    vm.startBlock();
+    vm.handleNoteOn(60, 1.0f);
+
+    vm.handleController(1, 0.5f);    // mapped to a host parameter by the processor
+    vm.handleController(64, 1.0f);
+
+    std::vector<float> block(256, 0.0f);
+    vm.render(block.data(), 256);
+
+    REQUIRE(vm.getControllerStats().applied == 2);
+    REQUIRE(vm.getControllerStats().voiceCalls == 0);
+}
+
+TEST_CASE("CC routing: 10k CC messages per second across 16 voices", "[voicemanager][cc][stress]")
+{
+    constexpr double sr          = 48000.0;
+    constexpr int    blockSize   = 256;
+    constexpr int    seconds     = 4;
+    constexpr int    ccPerSecond = 10000;
+    constexpr int    numNotes    = 16;
+
+    VoiceManager vm(makeSnap);
+    vm.setNumRenderThreads(1);
+    vm.prepare(sr, blockSize);
+    vm.startBlock();
+
+    for (int n = 0; n < numNotes; ++n)
+        vm.handleNoteOn(48 + n, 1.0f);
+
+    const int numBlocks    = static_cast<int>(seconds * sr) / blockSize;
+    const int ccPerBlock   = static_cast<int>(static_cast<double>(ccPerSecond) * blockSize / sr + 0.5);
+    const int sweptCCs[]   = { 3, 4, 5, 7 };   // a fast sweep on four knobs
+
+    std::vector<float> block(blockSize, 0.0f);
+    double worstBlockUs = 0.0;
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        const auto bt0 = std::chrono::steady_clock::now();
+
+        vm.startBlock();
+        for (int m = 0; m < ccPerBlock; ++m)
+        {
+            const int   cc   = sweptCCs[m % 4];
+            const float norm = static_cast<float>((b * ccPerBlock + m) % 128) / 127.0f;
+            vm.handleController(cc, norm);
+        }
+        vm.render(block.data(), blockSize);
+
+        const auto bt1 = std::chrono::steady_clock::now();
+        worstBlockUs = std::max(worstBlockUs, std::chrono::duration<double, std::micro>(bt1 - bt0).count());
+    }
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const auto& stats = vm.getControllerStats();
+    const auto  total = static_cast<uint64_t>(numBlocks) * static_cast<uint64_t>(ccPerBlock);
+
+    REQUIRE(stats.received == total);
+
+    // Coalesced: at most one application per swept CC per block, each
+    // fanned out only to the active voices.
+    REQUIRE(stats.applied <= static_cast<uint64_t>(numBlocks) * 4);
+    REQUIRE(stats.voiceCalls <= stats.applied * numNotes);
+
+    const double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    std::cout << "\n[CC stress] " << total << " CCs over " << seconds << " s audio"
+              << " (" << ccPerBlock << " per block, " << numNotes << " voices)"
+              << "\n  applied=" << stats.applied << " voiceCalls=" << stats.voiceCalls
+              << "\n  wall=" << ms << " ms, worst block=" << worstBlockUs << " us"
+              << " (budget " << 1.0e6 * blockSize / sr << " us)" << std::endl;
+}
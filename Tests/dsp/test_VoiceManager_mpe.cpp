@@ -0,0 +1,197 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/VoiceManager.h"
+#include "dsp/voices/VoiceA.h"
+#include "params/ParameterSnapshot.h"
+#include <memory>
+#include <vector>
+
+// ============================================================
+// MPE dispatch: member-channel expression reaches one voice
+// ============================================================
+
+namespace {
+
+struct SpyVoice : BaseVoice
+{
+    void prepare(double) override {}
+    void noteOn(const ParameterSnapshot&, int n, float) override { note = n; active = true; }
+    void noteOff() override { active = false; }
+    void render(float*, int) override {}
+    bool  isActive() const override { return active; }
+    int   getNote() const noexcept override { return note; }
+    float getCurrentLevel() const override { return 0.0f; }
+
+    void setExpression(const NoteExpression& e, bool immediate) override
+    {
+        last = e;
+        lastImmediate = immediate;
+        ++calls;
+    }
+
+    int  note = -1;
+    bool active = false;
+    NoteExpression last;
+    bool lastImmediate = false;
+    int  calls = 0;
+};
+
+struct SpyPool
+{
+    std::vector<SpyVoice*> voices;
+
+    VoiceManager::VoiceFactory factory()
+    {
+        return [this](VoiceMode) {
+            auto v = std::make_unique<SpyVoice>();
+            voices.push_back(v.get());
+            return v;
+        };
+    }
+
+    int totalCalls() const
+    {
+        int n = 0;
+        for (auto* v : voices) n += v->calls;
+        return n;
+    }
+
+    void resetCalls()
+    {
+        for (auto* v : voices) v->calls = 0;
+    }
+};
+
+ParameterSnapshot makeSnap() { return ParameterSnapshot {}; }
+
+} // namespace
+
+TEST_CASE("MPE: member-channel expression goes only to the owning voice", "[voicemanager][mpe]")
+{
+    SpyPool pool;
+    VoiceManager vm(makeSnap, pool.factory());
+    vm.prepare(48000.0);
+    vm.setMpeMemberChannels(15);
+    vm.startBlock();
+
+    vm.handleNoteOn(60, 1.0f, 2);
+    vm.handleNoteOn(64, 1.0f, 3);
+
+    const int v2 = vm.getVoiceForChannel(2);
+    const int v3 = vm.getVoiceForChannel(3);
+    REQUIRE(v2 >= 0);
+    REQUIRE(v3 >= 0);
+    REQUIRE(v2 != v3);
+    REQUIRE(vm.getVoiceForChannel(4) == -1);
+
+    // Note start snaps to the channel's state.
+    REQUIRE(pool.voices[static_cast<size_t>(v2)]->lastImmediate);
+
+    pool.resetCalls();
+    vm.handlePitchBend(3, 0.5f);
+    vm.handleChannelPressure(3, 0.25f);
+    vm.handleTimbre(3, 0.9f);
+
+    REQUIRE(pool.totalCalls() == 3);
+    const auto& e = pool.voices[static_cast<size_t>(v3)]->last;
+    REQUIRE(pool.voices[static_cast<size_t>(v3)]->calls == 3);
+    REQUIRE(e.bendSemis == Approx(0.5f * VoiceManager::mpeMemberBendRange));
+    REQUIRE(e.pressure  == Approx(0.25f));
+    REQUIRE(e.timbre    == Approx(0.9f));
+    REQUIRE_FALSE(pool.voices[static_cast<size_t>(v3)]->lastImmediate);
+
+    // Master-channel bend reaches every voice and adds to member bend.
+    pool.resetCalls();
+    vm.handlePitchBend(1, 1.0f);
+    REQUIRE(pool.totalCalls() == static_cast<int>(pool.voices.size()));
+    REQUIRE(pool.voices[static_cast<size_t>(v3)]->last.bendSemis
+            == Approx(0.5f * VoiceManager::mpeMemberBendRange + VoiceManager::masterBendRange));
+
+    // Note-off matches the channel as well as the note.
+    vm.handleNoteOff(60, 3);
+    REQUIRE(pool.voices[static_cast<size_t>(v2)]->active);
+    vm.handleNoteOff(60, 2);
+    REQUIRE_FALSE(pool.voices[static_cast<size_t>(v2)]->active);
+}
+
+TEST_CASE("MPE: channel state set before the note is applied at note-on", "[voicemanager][mpe]")
+{
+    SpyPool pool;
+    VoiceManager vm(makeSnap, pool.factory());
+    vm.prepare(48000.0);
+    vm.setMpeMemberChannels(15);
+    vm.startBlock();
+    vm.prepareVoices();
+
+    vm.handlePitchBend(5, -0.25f);
+    vm.handleChannelPressure(5, 0.6f);
+    REQUIRE(pool.totalCalls() == 0);   // no voice owns channel 5 yet
+
+    vm.handleNoteOn(67, 1.0f, 5);
+    const auto* v = pool.voices[static_cast<size_t>(vm.getVoiceForChannel(5))];
+    REQUIRE(v->lastImmediate);
+    REQUIRE(v->last.bendSemis == Approx(-0.25f * VoiceManager::mpeMemberBendRange));
+    REQUIRE(v->last.pressure  == Approx(0.6f));
+}
+
+TEST_CASE("MPE off: bend and pressure apply to all voices", "[voicemanager][mpe]")
+{
+    SpyPool pool;
+    VoiceManager vm(makeSnap, pool.factory());
+    vm.prepare(48000.0);
+    vm.startBlock();
+
+    vm.handleNoteOn(60, 1.0f, 2);
+    REQUIRE_FALSE(vm.isMpeEnabled());
+    REQUIRE(vm.getVoiceForChannel(2) == -1);
+
+    pool.resetCalls();
+    vm.handlePitchBend(2, 1.0f);
+    REQUIRE(pool.totalCalls() == static_cast<int>(pool.voices.size()));
+    REQUIRE(pool.voices.front()->last.bendSemis == Approx(VoiceManager::masterBendRange));
+
+    // Any channel's note-off releases the note.
+    vm.handleNoteOff(60, 9);
+    for (auto* v : pool.voices)
+        REQUIRE_FALSE(v->active);
+}
+
+TEST_CASE("VoiceA: bend glides the pitch, pressure raises the level", "[voice][mpe]")
+{
+    ParameterSnapshot snap;
+    snap.envAttack = 0.0f;
+
+    VoiceA v;
+    v.prepare(48000.0);
+    v.noteOn(snap, 69, 1.0f);
+
+    auto zeroCrossings = [](const std::vector<float>& b) {
+        int n = 0;
+        for (size_t i = 1; i < b.size(); ++i)
+            if ((b[i - 1] < 0.0f) != (b[i] < 0.0f)) ++n;
+        return n;
+    };
+
+    std::vector<float> block(4800, 0.0f);
+    v.render(block.data(), 4800);          // 100 ms at 440 Hz
+    const int base = zeroCrossings(block);
+
+    v.setExpression({ 12.0f, 0.0f, 0.5f }, false);
+    std::fill(block.begin(), block.end(), 0.0f);
+    v.render(block.data(), 4800);          // glide completes within 10 ms
+    REQUIRE(v.getExpression().pitchRatio() == Approx(2.0f).epsilon(1e-4));
+    REQUIRE(zeroCrossings(block) > base * 3 / 2);
+
+    float peakBefore = 0.0f;
+    for (float x : block) peakBefore = std::max(peakBefore, std::fabs(x));
+
+    v.setExpression({ 12.0f, 1.0f, 0.5f }, true);
+    std::fill(block.begin(), block.end(), 0.0f);
+    v.render(block.data(), 4800);
+    float peakAfter = 0.0f;
+    for (float x : block) peakAfter = std::max(peakAfter, std::fabs(x));
+
+    REQUIRE(peakAfter == Approx(2.0f * peakBefore).epsilon(1e-3));
+}
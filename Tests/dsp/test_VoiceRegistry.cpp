@@ -0,0 +1,74 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dsp/VoiceRegistry.h"
+#include "dsp/VoiceManager.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+TEST_CASE("VoiceRegistry creates VoiceA by name", "[registry]")
+{
+    auto voice = VoiceRegistry::makeVoice("voiceA");
+    REQUIRE(voice != nullptr);
+    REQUIRE(dynamic_cast<VoiceA*>(voice.get()) != nullptr);
+    REQUIRE_FALSE(voice->isActive());
+
+    voice->prepare(44100.0);
+    ParameterSnapshot snap;
+    snap.oscFreq = 440.0f;
+    snap.envAttack = 0.001f;
+    snap.envRelease = 0.05f;
+
+    voice->noteOn(snap, 69, 1.0f);
+    REQUIRE(voice->isActive());
+
+    std::vector<float> buf(64, 0.0f);
+    voice->render(buf.data(), 64);
+    REQUIRE(std::any_of(buf.begin(), buf.end(),
+                        [](float x){ return std::fabs(x) > 0.0f; }));
+
+    REQUIRE(VoiceRegistry::makeVoice("noSuchVoice") == nullptr);
+}
+
+TEST_CASE("VoiceRegistry maps every VoiceMode to its voice type", "[registry]")
+{
+    static_assert(VoiceRegistry::size == numVoiceModes);
+    static_assert(VoiceRegistry::maxPolyphony(VoiceMode::VoiceEns) < VoiceManager::maxVoices);
+    static_assert(VoiceRegistry::arenaBytes(VoiceMode::VoiceFM)
+                  == VoiceArena::slotBytes<VoiceFM>() * VoiceManager::maxVoices);
+
+    int index = 0;
+    VoiceRegistry::forEach([&](auto tag)
+    {
+        using Voice = typename decltype(tag)::type;
+        const auto mode = toVoiceMode(index);
+
+        REQUIRE(VoiceTraits<Voice>::mode == mode);
+        REQUIRE(VoiceRegistry::voiceBytes(mode) == sizeof(Voice));
+        REQUIRE(VoiceRegistry::maxPolyphony(mode) == VoiceManager::polyphonyForMode(mode));
+
+        // Static dispatch and name lookup agree with the list.
+        const bool sameType = VoiceRegistry::visit(mode, [](auto t)
+        {
+            return std::is_same_v<typename decltype(t)::type, Voice>;
+        });
+        REQUIRE(sameType);
+
+        VoiceMode found {};
+        REQUIRE(VoiceRegistry::findMode(VoiceRegistry::name(mode), found));
+        REQUIRE(found == mode);
+
+        auto v = VoiceRegistry::makeVoice(mode);
+        REQUIRE(v != nullptr);
+        REQUIRE(typeid(*v) == typeid(Voice));
+        ++index;
+    });
+
+    REQUIRE(index == numVoiceModes);
+    REQUIRE(toVoiceMode(numVoiceModes) == VoiceMode::VoiceA);
+    REQUIRE(toVoiceMode(-1) == VoiceMode::VoiceA);
+
+    REQUIRE_FALSE(VoiceRegistry::supportsBlockRender(VoiceMode::VoiceA));
+    REQUIRE(VoiceRegistry::supportsBlockRender(VoiceMode::VoiceFM));
+}
@@ -0,0 +1,312 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "dsp/VoiceManager.h"
+#include "dsp/VoiceRenderPool.h"
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// ============================================================
+// Parallel voice rendering — pool semantics + bit-identity
+// ============================================================
+
+TEST_CASE("VoiceRenderPool runs every task exactly once", "[voicemanager][parallel]")
+{
+    VoiceRenderPool pool;
+    pool.start(3);
+    REQUIRE(pool.getNumThreads() == 4);
+
+    std::array<std::atomic<int>, 37> hits {};
+
+    auto task = [](void* ctx, int t) {
+        (*static_cast<std::array<std::atomic<int>, 37>*>(ctx))[static_cast<size_t>(t)].fetch_add(1);
+    };
+
+    // Many back-to-back jobs exercise both the spin and the park paths.
+    for (int job = 0; job < 200; ++job)
+        pool.run(task, &hits, 37);
+
+    for (auto& h : hits)
+        REQUIRE(h.load() == 200);
+
+    pool.stop();
+    REQUIRE(pool.getNumThreads() == 1);
+}
+
+TEST_CASE("VoiceRenderPool wakes parked workers for every job", "[voicemanager][parallel]")
+{
+    VoiceRenderPool pool;
+    pool.start(3);
+
+    std::array<std::atomic<int>, 8> hits {};
+
+    auto task = [](void* ctx, int t) {
+        (*static_cast<std::array<std::atomic<int>, 8>*>(ctx))[static_cast<size_t>(t)].fetch_add(1);
+    };
+
+    // Idle long enough between jobs that every worker has parked.
+    for (int job = 0; job < 20; ++job)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        pool.run(task, &hits, 8);
+    }
+
+    for (auto& h : hits)
+        REQUIRE(h.load() == 20);
+
+    // Parked workers must also leave promptly on stop().
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    pool.stop();
+    REQUIRE(pool.getNumThreads() == 1);
+}
+
+TEST_CASE("VoiceRenderPool steals work and reports imbalance", "[voicemanager][parallel]")
+{
+    VoiceRenderPool pool;
+    pool.start(3);
+
+    // Heterogeneous costs: a few heavy tasks among many light ones.
+    struct Ctx
+    {
+        std::array<std::atomic<int>, 24> hits {};
+        std::array<int, 24> spinsPerTask {};
+    } ctx;
+
+    for (int t = 0; t < 24; ++t)
+        ctx.spinsPerTask[static_cast<size_t>(t)] = (t % 8 == 0) ? 200000 : 2000;
+
+    auto task = [](void* c, int t) {
+        auto& x = *static_cast<Ctx*>(c);
+        volatile int sink = 0;
+        for (int i = 0; i < x.spinsPerTask[static_cast<size_t>(t)]; ++i)
+            sink = sink + i;
+        x.hits[static_cast<size_t>(t)].fetch_add(1);
+    };
+
+    std::array<float, 24> hints {};
+    std::array<float, 24> costs {};
+
+    // First job without hints, second seeded with measured costs.
+    pool.run(task, &ctx, 24, nullptr, costs.data());
+    hints = costs;
+    pool.run(task, &ctx, 24, hints.data(), costs.data());
+
+    for (auto& h : ctx.hits)
+        REQUIRE(h.load() == 2);
+
+    for (float c : costs)
+        REQUIRE(c > 0.0f);
+
+    const auto& m = pool.getLastMetrics();
+    REQUIRE(m.numTasks == 24);
+    REQUIRE(m.numThreads == 4);
+    REQUIRE(m.imbalance >= 1.0);
+    REQUIRE(m.imbalance <= 4.0);   // can never exceed the thread count
+}
+
+namespace {
+
+std::vector<float> renderScenario(int numThreads, VoiceMode mode, int blockSize = 256)
+{
+    VoiceManager vm([] {
+        ParameterSnapshot s;
+        s.envAttack  = 0.002f;
+        s.envRelease = 0.05f;
+        return s;
+    });
+
+    vm.setNumRenderThreads(numThreads);
+    vm.setParallelThreshold(1);
+    vm.setMode(mode);
+    vm.prepare(48000.0, blockSize);
+    vm.setAudioSynthesisEnabled(true);
+    vm.startBlock();
+
+    for (int n = 0; n < 24; ++n)
+        vm.handleNoteOn(36 + n, 1.0f);
+
+    std::vector<float> out;
+    std::vector<float> block(static_cast<size_t>(blockSize), 0.0f);
+
+    for (int b = 0; b < 12; ++b)
+    {
+        if (b == 6)
+            for (int n = 0; n < 24; n += 2)
+                vm.handleNoteOff(36 + n);
+
+        vm.startBlock();
+        vm.render(block.data(), static_cast<int>(block.size()));
+        out.insert(out.end(), block.begin(), block.end());
+    }
+
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("Parallel render is bit-identical to serial render", "[voicemanager][parallel]")
+{
+    for (auto mode : { VoiceMode::VoiceA, VoiceMode::VoiceDopp })
+    {
+        const auto serial   = renderScenario(1, mode);
+        const auto parallel = renderScenario(4, mode);
+
+        REQUIRE(serial.size() == parallel.size());
+        REQUIRE(std::memcmp(serial.data(), parallel.data(),
+                            serial.size() * sizeof(float)) == 0);
+    }
+}
+
+TEST_CASE("Parallel render mixes every chunk of blocks beyond maxTasks chunks", "[voicemanager][parallel]")
+{
+    // 8192 samples = 128 default mix chunks, twice the pool's task limit.
+    constexpr int bigBlock = 8192;
+
+    const auto serial   = renderScenario(1, VoiceMode::VoiceA, bigBlock);
+    const auto parallel = renderScenario(3, VoiceMode::VoiceA, bigBlock);
+
+    REQUIRE(serial.size() == parallel.size());
+    REQUIRE(std::memcmp(serial.data(), parallel.data(),
+                        serial.size() * sizeof(float)) == 0);
+
+    // The tail of the first block carries signal.
+    float tailEnergy = 0.0f;
+    for (int i = bigBlock / 2; i < bigBlock; ++i)
+        tailEnergy += parallel[static_cast<size_t>(i)] * parallel[static_cast<size_t>(i)];
+    REQUIRE(tailEnergy > 0.0f);
+}
+
+TEST_CASE("Mixed voice types render bit-identically and report metrics", "[voicemanager][parallel]")
+{
+    auto render = [](int numThreads, VoiceManager::RenderMetrics& metricsOut)
+    {
+        int made = 0;
+        VoiceManager vm([] { return ParameterSnapshot{}; },
+                        [&made](VoiceMode) -> std::unique_ptr<BaseVoice> {
+                            // Every fourth slot is a heavy VoiceDopp voice.
+                            if ((made++ % 4) == 0)
+                                return std::make_unique<VoiceDopp>();
+                            return std::make_unique<VoiceA>();
+                        });
+
+        vm.setNumRenderThreads(numThreads);
+        vm.setParallelThreshold(1);
+        vm.prepare(48000.0, 512);
+        vm.setAudioSynthesisEnabled(true);
+        vm.startBlock();
+
+        for (int n = 0; n < VoiceManager::maxVoices; ++n)
+            vm.handleNoteOn(30 + n, 1.0f);
+
+        std::vector<float> out;
+        std::vector<float> block(512, 0.0f);
+        for (int b = 0; b < 4; ++b)
+        {
+            vm.render(block.data(), static_cast<int>(block.size()));
+            out.insert(out.end(), block.begin(), block.end());
+        }
+
+        metricsOut = vm.getLastRenderMetrics();
+        return out;
+    };
+
+    VoiceManager::RenderMetrics serialMetrics, parallelMetrics;
+    const auto serial   = render(1, serialMetrics);
+    const auto parallel = render(4, parallelMetrics);
+
+    REQUIRE(std::memcmp(serial.data(), parallel.data(), serial.size() * sizeof(float)) == 0);
+
+    REQUIRE_FALSE(serialMetrics.parallel);
+    REQUIRE(parallelMetrics.parallel);
+    REQUIRE(parallelMetrics.threads == 4);
+    REQUIRE(parallelMetrics.activeVoices == VoiceManager::maxVoices);
+    REQUIRE(parallelMetrics.imbalance >= 1.0);
+}
+
+TEST_CASE("Blocks larger than the prepared size fall back to serial", "[voicemanager][parallel]")
+{
+    VoiceManager vm([] { return ParameterSnapshot{}; });
+    vm.setNumRenderThreads(3);
+    vm.setParallelThreshold(1);
+    vm.prepare(48000.0, 64);
+    vm.startBlock();
+
+    for (int n = 0; n < 8; ++n)
+        vm.handleNoteOn(60 + n, 1.0f);
+
+    std::vector<float> big(512, 0.0f);
+    vm.render(big.data(), static_cast<int>(big.size()));
+
+    REQUIRE(std::any_of(big.begin(), big.end(), [](float x) { return std::fabs(x) > 0.0f; }));
+}
+
+TEST_CASE("Render thread count changes wait for the next prepare()", "[voicemanager][parallel]")
+{
+    VoiceManager vm([] { return ParameterSnapshot{}; });
+    vm.setNumRenderThreads(3);
+    vm.setParallelThreshold(1);
+    vm.prepare(48000.0, 256);
+    vm.startBlock();
+
+    for (int n = 0; n < 8; ++n)
+        vm.handleNoteOn(60 + n, 1.0f);
+
+    std::vector<float> block(256, 0.0f);
+    vm.render(block.data(), static_cast<int>(block.size()));
+    REQUIRE(vm.getLastRenderMetrics().threads == 3);
+
+    // Recorded only: the live pool keeps its workers.
+    vm.setNumRenderThreads(2);
+    REQUIRE(vm.getNumRenderThreads() == 2);
+    vm.render(block.data(), static_cast<int>(block.size()));
+    REQUIRE(vm.getLastRenderMetrics().threads == 3);
+
+    vm.prepare(48000.0, 256);
+    vm.startBlock();
+    for (int n = 0; n < 8; ++n)
+        vm.handleNoteOn(60 + n, 1.0f);
+    vm.render(block.data(), static_cast<int>(block.size()));
+    REQUIRE(vm.getLastRenderMetrics().threads == 2);
+}
+
+TEST_CASE("VoiceRenderPool restarts cleanly between jobs", "[voicemanager][parallel]")
+{
+    VoiceRenderPool pool;
+    std::array<std::atomic<int>, 16> hits {};
+
+    auto task = [](void* ctx, int t) {
+        (*static_cast<std::array<std::atomic<int>, 16>*>(ctx))[static_cast<size_t>(t)].fetch_add(1);
+    };
+
+    for (int round = 0; round < 50; ++round)
+    {
+        pool.start(1 + round % 3);
+        pool.run(task, &hits, 16);
+    }
+    pool.stop();
+
+    for (auto& h : hits)
+        REQUIRE(h.load() == 50);
+}
+
+TEST_CASE("VoiceManager renders serially unless threads are requested", "[voicemanager][parallel]")
+{
+    VoiceManager vm([] { return ParameterSnapshot{}; });
+    REQUIRE(vm.getNumRenderThreads() == 1);
+
+    vm.setParallelThreshold(1);
+    vm.prepare(48000.0, 256);
+    vm.startBlock();
+
+    for (int n = 0; n < 16; ++n)
+        vm.handleNoteOn(50 + n, 1.0f);
+
+    std::vector<float> block(256, 0.0f);
+    vm.render(block.data(), static_cast<int>(block.size()));
+
+    REQUIRE_FALSE(vm.getLastRenderMetrics().parallel);
+    REQUIRE(vm.getLastRenderMetrics().threads == 1);
+    REQUIRE(VoiceManager::suggestedNumRenderThreads() >= 1);
+}
@@ -43,7 +43,10 @@ TEST_CASE("VoiceManager: mode wiring and factory selection", "[voice][manager][C
         return std::make_unique<VoiceA>(); // arbitrary
     });
 
-    vm.prepare(48000.0); // forces rebuild
+    vm.prepare(48000.0);
+    REQUIRE(fmUsed == false);   // voice construction is deferred
+
+    vm.prepareVoices();         // forces the build
 
     REQUIRE(fmUsed == true);
 }
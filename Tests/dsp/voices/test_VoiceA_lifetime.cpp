@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include "dsp/voices/VoiceA.h"
+#include "dsp/VoiceManager.h"
+#include "params/ParameterSnapshot.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// ============================================================
+// VoiceA retirement: analytic tail end, live-portion rendering
+// ============================================================
+
+TEST_CASE("VoiceA: slow attack at low velocity survives its first block", "[voice][lifetime]")
+{
+    ParameterSnapshot snap;
+    snap.envAttack  = 2.0f;   // ~1e-5 per sample at 48 kHz
+    snap.envRelease = 0.2f;
+
+    VoiceA voice;
+    voice.prepare(48000.0);
+    voice.noteOn(snap, 60, 0.05f);
+
+    std::vector<float> block(64, 0.0f);
+    for (int b = 0; b < 8; ++b)
+    {
+        voice.render(block.data(), 64);
+        REQUIRE(voice.isActive());
+        REQUIRE(voice.getSamplesRendered() == 64);
+    }
+}
+
+TEST_CASE("VoiceA: tail renders only its live samples, then nothing", "[voice][lifetime]")
+{
+    ParameterSnapshot snap;
+    snap.envAttack  = 0.001f;
+    snap.envRelease = 0.05f;
+
+    VoiceA voice;
+    voice.prepare(48000.0);
+    voice.noteOn(snap, 69, 1.0f);
+
+    constexpr int blockSize = 256;
+    std::vector<float> block(blockSize, 0.0f);
+    for (int b = 0; b < 4; ++b)
+        voice.render(block.data(), blockSize);
+
+    REQUIRE(voice.getRemainingSamples() == EnvelopeA::unbounded);
+
+    voice.noteOff();
+    const uint64_t remaining = voice.getRemainingSamples();
+    REQUIRE(remaining > 0);
+    REQUIRE(remaining <= static_cast<uint64_t>(0.05 * 48000.0));
+
+    uint64_t total = 0;
+    while (voice.isActive())
+    {
+        // Sentinel: samples past the live portion must stay untouched.
+        std::fill(block.begin(), block.end(), 7.0f);
+        voice.render(block.data(), blockSize);
+
+        const int n = voice.getSamplesRendered();
+        REQUIRE(n >= 0);
+        REQUIRE(n <= blockSize);
+        for (int i = n; i < blockSize; ++i)
+            REQUIRE(block[static_cast<size_t>(i)] == 7.0f);
+
+        total += static_cast<uint64_t>(n);
+    }
+
+    REQUIRE(total == remaining);
+
+    // Idle fast path: nothing rendered, buffer untouched.
+    std::fill(block.begin(), block.end(), 7.0f);
+    voice.render(block.data(), blockSize);
+    REQUIRE(voice.getSamplesRendered() == 0);
+    REQUIRE(std::all_of(block.begin(), block.end(), [](float x) { return x == 7.0f; }));
+}
+
+TEST_CASE("VoiceManager: render metrics count live voice-samples", "[voice][lifetime][manager]")
+{
+    ParameterSnapshot snap;
+    snap.voiceMode = VoiceMode::VoiceA;
+
+    VoiceManager vm([&] { return snap; });
+    vm.prepare(48000.0, 256);
+    vm.startBlock();
+
+    vm.handleNoteOn(60, 1.0f);
+    vm.handleNoteOn(64, 1.0f);
+
+    std::vector<float> block(256, 0.0f);
+    vm.render(block.data(), 256);
+    REQUIRE(vm.getLastRenderMetrics().samplesRendered == 2 * 256);
+
+    vm.handleNoteOff(60);
+    vm.handleNoteOff(64);
+
+    // Walk the release: the final block renders fewer than 2 × 256.
+    int lastCount = 0;
+    for (int b = 0; b < 200 && vm.getLastRenderMetrics().activeVoices > 0; ++b)
+    {
+        vm.render(block.data(), 256);
+        if (vm.getLastRenderMetrics().activeVoices > 0)
+            lastCount = vm.getLastRenderMetrics().samplesRendered;
+    }
+
+    REQUIRE(vm.getLastRenderMetrics().activeVoices == 0);
+    REQUIRE(vm.getLastRenderMetrics().samplesRendered == 0);
+    REQUIRE(lastCount > 0);
+    REQUIRE(lastCount < 2 * 256);
+}
@@ -0,0 +1,155 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/voices/VoiceDopp.h"
+#include "dsp/HalfBandDecimator.h"
+#include "params/ParameterSnapshot.h"
+#include "utils/dsp_metrics.h"
+#include <vector>
+
+// ============================================================
+// VoiceDopp oversampling — decimator response, mode selection,
+// FFT-based aliasing measurements
+// ============================================================
+
+namespace {
+
+std::vector<float> renderDopp(double carrierHz,
+                              VoiceDopp::OversamplingMode mode,
+                              int& factorOut,
+                              double sr = 48000.0,
+                              int numBlocks = 64,
+                              int blockSize = 256)
+{
+    VoiceDopp v;
+    v.prepare(sr);
+    v.setOversamplingMode(mode);
+
+    ParameterSnapshot s;
+    s.oscFreq    = static_cast<float>(carrierHz);
+    s.envAttack  = 0.001f;
+    s.envRelease = 0.2f;
+    v.noteOn(s, 69, 1.0f);
+
+    v.setAudioSynthesisEnabled(true);
+    v.setFieldPulseFrequencyForTest(0.5);
+
+    std::vector<float> out;
+    std::vector<float> block(static_cast<size_t>(blockSize));
+
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        std::fill(block.begin(), block.end(), 0.0f);
+        v.render(block.data(), blockSize);
+        out.insert(out.end(), block.begin(), block.end());
+    }
+
+    factorOut = v.getOversamplingFactor();
+
+    // Skip the attack so the spectrum is stationary.
+    out.erase(out.begin(), out.begin() + blockSize * 4);
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("HalfBandDecimator passes DC and rejects the upper band", "[dsp][oversampling]")
+{
+    HalfBandDecimator dec;
+
+    // DC gain is exactly 1.
+    std::vector<float> in(256, 1.0f), out(128, 0.0f);
+    dec.process(in.data(), out.data(), 128);
+    REQUIRE(out.back() == Approx(1.0f).margin(1e-5f));
+
+    // A tone at 0.4·fs_in (folds to 0.1·fs_out) must be strongly attenuated.
+    dec.reset();
+    const double f = 0.4;
+    std::vector<float> tone(256);
+    double peak = 0.0;
+    for (int rep = 0; rep < 4; ++rep)
+    {
+        for (size_t i = 0; i < tone.size(); ++i)
+            tone[i] = static_cast<float>(std::sin(2.0 * M_PI * f * static_cast<double>(i + 256 * rep)));
+        dec.process(tone.data(), out.data(), 128);
+        if (rep > 0)
+            for (float y : out)
+                peak = std::max(peak, static_cast<double>(std::fabs(y)));
+    }
+    REQUIRE(peak < 1e-3);   // < −60 dB
+}
+
+TEST_CASE("VoiceDopp Auto oversampling stays at 1x for ordinary pitches", "[VoiceDopp][oversampling]")
+{
+    int autoFactor = 0, offFactor = 0;
+    const auto autoOut = renderDopp(440.0, VoiceDopp::OversamplingMode::Auto, autoFactor);
+    const auto offOut  = renderDopp(440.0, VoiceDopp::OversamplingMode::Off,  offFactor);
+
+    REQUIRE(autoFactor == 1);
+    REQUIRE(autoOut == offOut);   // no cost, no change
+}
+
+TEST_CASE("VoiceDopp oversampled path is time-aligned with the 1x path in band", "[VoiceDopp][oversampling]")
+{
+    int f1 = 0, f2 = 0, f4 = 0;
+    const auto ref  = renderDopp(3000.0, VoiceDopp::OversamplingMode::Off,     f1);
+    const auto os2x = renderDopp(3000.0, VoiceDopp::OversamplingMode::Force2x, f2);
+    const auto os4x = renderDopp(3000.0, VoiceDopp::OversamplingMode::Force4x, f4);
+
+    REQUIRE(f2 == 2);
+    REQUIRE(f4 == 4);
+
+    const float peak = computePeak(ref);
+    float maxErr2 = 0.0f, maxErr4 = 0.0f;
+    for (size_t i = 0; i < ref.size(); ++i)
+    {
+        maxErr2 = std::max(maxErr2, std::fabs(ref[i] - os2x[i]));
+        maxErr4 = std::max(maxErr4, std::fabs(ref[i] - os4x[i]));
+    }
+
+    // Latency-compensated: differences are only passband ripple.
+    REQUIRE(maxErr2 < 0.01f * peak);
+    REQUIRE(maxErr4 < 0.01f * peak);
+}
+
+TEST_CASE("VoiceDopp oversampling removes aliasing of a super-Nyquist carrier", "[VoiceDopp][oversampling]")
+{
+    const double sr = 48000.0;
+    const double carrierHz = 30000.0;          // folds to 18 kHz at 1x
+    const double aliasHz   = sr - carrierHz;
+
+    int offFactor = 0, autoFactor = 0;
+    const auto naive = renderDopp(carrierHz, VoiceDopp::OversamplingMode::Off,  offFactor);
+    const auto clean = renderDopp(carrierHz, VoiceDopp::OversamplingMode::Auto, autoFactor);
+
+    REQUIRE(offFactor == 1);
+    REQUIRE(autoFactor >= 2);
+
+    const auto pNaive = computePowerSpectrum(naive);
+    const auto pClean = computePowerSpectrum(clean);
+
+    const double aliasNaive = bandEnergy(pNaive, sr, aliasHz - 200.0, aliasHz + 200.0);
+    const double aliasClean = bandEnergy(pClean, sr, aliasHz - 200.0, aliasHz + 200.0);
+
+    const double suppressionDb = 10.0 * std::log10(aliasNaive / std::max(aliasClean, 1e-30));
+    std::cout << "[VoiceDopp OS] alias suppression at " << aliasHz << " Hz = "
+              << suppressionDb << " dB\n";
+
+    REQUIRE(suppressionDb > 50.0);
+}
+
+TEST_CASE("VoiceDopp aliasing metric: near-Nyquist partials stay clean with Auto", "[VoiceDopp][oversampling]")
+{
+    const double sr = 48000.0;
+    const double carrierHz = 23000.0;          // pulse sidebands approach Nyquist
+
+    int factor = 0;
+    const auto clean = renderDopp(carrierHz, VoiceDopp::OversamplingMode::Auto, factor);
+    REQUIRE(factor >= 2);
+
+    // Everything outside the carrier neighbourhood is leakage/aliasing.
+    const double ratioDb = aliasingRatioDb(clean, sr, { carrierHz }, 400.0);
+    std::cout << "[VoiceDopp OS] out-of-band / in-band = " << ratioDb << " dB\n";
+    REQUIRE(ratioDb < -40.0);
+}
@@ -0,0 +1,214 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/VoiceManager.h"
+#include "dsp/voices/VoiceEns.h"
+#include "dsp/filters/FreqBandEns.h"
+#include "dsp/envelopes/EnvelopeEns.h"
+#include "params/ParameterSnapshot.h"
+#include "utils/dsp_metrics.h"
+#include <cmath>
+#include <vector>
+
+// ============================================================
+// VoiceEns — SIMD band bank vs scalar SVF, band-pass response,
+// per-band envelopes, mode wiring and polyphony cap
+// ============================================================
+
+namespace {
+
+constexpr double kSr = 48000.0;
+
+// Envelope bank held at 1.0 on every band (no attack/decay).
+EnvelopeEns unityEnvelope()
+{
+    EnvelopeEns env;
+    env.prepare(kSr);
+    env.setAttack(0.0f);
+    env.setSustain(1.0f);
+    for (int b = 0; b < EnvelopeEns::maxBands; ++b)
+        env.setBand(b, 1.0f, 0.0f);
+    env.noteOn();
+    for (int b = 0; b < EnvelopeEns::maxBands; ++b)
+        env.levels()[b] = 1.0f;
+    return env;
+}
+
+// Plain double-precision TPT SVF band-pass (k·v1).
+struct ScalarSvf
+{
+    double a1, a2, a3, k, ic1 = 0.0, ic2 = 0.0;
+
+    ScalarSvf(double fc, double q)
+    {
+        const double g = std::tan(M_PI * fc / kSr);
+        k  = 1.0 / q;
+        a1 = 1.0 / (1.0 + g * (g + k));
+        a2 = g * a1;
+        a3 = g * a2;
+    }
+
+    double process(double x)
+    {
+        const double v3 = x - ic2;
+        const double v1 = a1 * ic1 + a2 * v3;
+        const double v2 = ic2 + a2 * ic1 + a3 * v3;
+        ic1 = 2.0 * v1 - ic1;
+        ic2 = 2.0 * v2 - ic2;
+        return k * v1;
+    }
+};
+
+std::vector<float> renderEns(VoiceEns& v, int total, int blockSize, int noteOffAt = -1)
+{
+    std::vector<float> out(static_cast<size_t>(total), 0.0f);
+    for (int pos = 0; pos < total; pos += blockSize)
+    {
+        if (pos == noteOffAt)
+            v.noteOff();
+        v.render(out.data() + pos, std::min(blockSize, total - pos));
+    }
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("VoiceEns is wired to VoiceMode::VoiceEns with a polyphony cap", "[voice][ens]")
+{
+    REQUIRE(toVoiceMode(4) == VoiceMode::VoiceEns);
+
+    VoiceManager vm([] { return ParameterSnapshot{}; });
+    auto v = vm.makeVoiceForMode(VoiceMode::VoiceEns);
+    REQUIRE(dynamic_cast<VoiceEns*>(v.get()) != nullptr);
+
+    const int cap = VoiceManager::polyphonyForMode(VoiceMode::VoiceEns);
+    REQUIRE(cap == VoiceEns::polyphonyLimit(VoiceEns::defaultBands));
+    REQUIRE(cap < VoiceManager::maxVoices);
+    REQUIRE(VoiceManager::polyphonyForMode(VoiceMode::VoiceA) == VoiceManager::maxVoices);
+
+    vm.setNumRenderThreads(1);
+    vm.setMode(VoiceMode::VoiceEns);
+    vm.prepare(kSr, 256);
+    vm.startBlock();
+
+    for (int n = 0; n < VoiceManager::maxVoices; ++n)
+        vm.handleNoteOn(40 + n, 1.0f);
+
+    std::vector<float> block(256, 0.0f);
+    vm.render(block.data(), 256);
+
+    REQUIRE(vm.getLastRenderMetrics().activeVoices == cap);
+}
+
+TEST_CASE("FreqBandEns lanes match a scalar SVF per band", "[voice][ens]")
+{
+    FreqBandEns bank;
+    bank.prepare(kSr);
+    bank.setNumBands(20);   // not a multiple of the lane width
+
+    std::vector<ScalarSvf> ref;
+    for (int b = 0; b < 20; ++b)
+    {
+        const double fc = 150.0 * (b + 1);
+        const double q  = 5.0 + b;
+        bank.setBand(b, fc, q, 1.0f);
+        ref.emplace_back(fc, q);
+    }
+
+    auto env = unityEnvelope();
+
+    std::vector<float> in(2048, 0.0f);
+    uint32_t s = 1u;
+    for (auto& x : in)
+    {
+        s = s * 1664525u + 1013904223u;
+        x = static_cast<float>(static_cast<int32_t>(s)) / 2147483648.0f;
+    }
+
+    std::vector<float> out(in.size(), 0.0f);
+    bank.processBlock(in.data(), out.data(), static_cast<int>(in.size()), env);
+
+    double maxErr = 0.0;
+    for (size_t n = 0; n < in.size(); ++n)
+    {
+        double y = 0.0;
+        for (auto& f : ref)
+            y += f.process(in[n]);
+        maxErr = std::max(maxErr, std::abs(y - out[n]));
+    }
+
+    REQUIRE(maxErr < 1.0e-4);
+}
+
+TEST_CASE("FreqBandEns band-pass has unit gain at its centre", "[voice][ens]")
+{
+    auto gainAt = [](double hz)
+    {
+        FreqBandEns bank;
+        bank.prepare(kSr);
+        bank.setNumBands(1);
+        bank.setBand(0, 1000.0, 20.0, 1.0f);
+        auto env = unityEnvelope();
+
+        std::vector<float> in(24000), out(24000, 0.0f);
+        for (size_t n = 0; n < in.size(); ++n)
+            in[n] = static_cast<float>(std::sin(2.0 * M_PI * hz * static_cast<double>(n) / kSr));
+
+        bank.processBlock(in.data(), out.data(), static_cast<int>(in.size()), env);
+        return computePeak(std::vector<float>(out.begin() + 12000, out.end()));
+    };
+
+    REQUIRE(gainAt(1000.0) == Approx(1.0f).margin(0.01f));
+    REQUIRE(gainAt(2000.0) < 0.05f);
+    REQUIRE(gainAt(500.0)  < 0.05f);
+}
+
+TEST_CASE("VoiceEns output centres on the note and stays bounded", "[voice][ens]")
+{
+    for (int bands : { 16, 32, 64 })
+    {
+        VoiceEns v;
+        v.setNumBands(bands);
+        v.prepare(kSr);
+
+        ParameterSnapshot s;
+        s.envAttack = 0.005f;
+        v.noteOn(s, 57, 1.0f);   // 220 Hz; upper bands pass Nyquist at 64
+
+        auto out = renderEns(v, 48000, 256);
+        const std::vector<float> tail(out.begin() + 4800, out.begin() + 4800 + 32768);
+
+        INFO("bands " << bands);
+        REQUIRE(std::all_of(out.begin(), out.end(), [](float x) { return std::isfinite(x); }));
+        REQUIRE(computeRMS(tail) > 0.02f);
+        REQUIRE(computePeak(out) < 1.0f);
+
+        // Fundamental band dominates with the default 1/(b+1) tilt.
+        const auto power = computePowerSpectrum(tail);
+        const double fund  = bandEnergy(power, kSr, 210.0, 230.0);
+        const double third = bandEnergy(power, kSr, 650.0, 670.0);
+        REQUIRE(fund > third);
+    }
+}
+
+TEST_CASE("VoiceEns per-band envelopes release and deactivate", "[voice][ens]")
+{
+    VoiceEns v;
+    v.prepare(kSr);
+
+    ParameterSnapshot s;
+    s.envAttack  = 0.005f;
+    s.envRelease = 0.05f;
+    v.noteOn(s, 60, 1.0f);
+
+    renderEns(v, 9600, 128);
+    REQUIRE(v.isActive());
+    REQUIRE(v.getCurrentLevel() > 0.0f);
+
+    v.noteOff();
+    auto released = renderEns(v, 24000, 128);
+
+    REQUIRE_FALSE(v.isActive());
+    REQUIRE(computePeak(std::vector<float>(released.end() - 4800, released.end())) == 0.0f);
+}
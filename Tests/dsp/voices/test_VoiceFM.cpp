@@ -0,0 +1,255 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/VoiceManager.h"
+#include "dsp/voices/VoiceFM.h"
+#include "dsp/envelopes/EnvelopeFM.h"
+#include "dsp/oscillators/SineTable.h"
+#include "params/ParameterSnapshot.h"
+#include "utils/dsp_metrics.h"
+#include <cmath>
+#include <vector>
+
+// ============================================================
+// VoiceFM — sine table, block envelopes, golden reference model
+// for every algorithm, chunking invariance, lifecycle
+// ============================================================
+
+namespace {
+
+constexpr double kSr = 48000.0;
+
+ParameterSnapshot fmSnapshot()
+{
+    ParameterSnapshot s;
+    s.envAttack  = 0.005f;
+    s.envRelease = 0.05f;
+    return s;
+}
+
+void configure(VoiceFM& v, FMAlgorithm alg)
+{
+    v.prepare(kSr);
+    v.setAlgorithm(alg);
+    v.setFeedback(0.3f);
+    v.setModulationDepth(1.0f);
+
+    const float ratios[VoiceFM::numOps] = { 1.0f, 2.0f, 3.0f, 0.5f };
+    const float levels[VoiceFM::numOps] = { 0.9f, 1.2f, 0.8f, 2.0f };
+    for (int k = 0; k < VoiceFM::numOps; ++k)
+    {
+        v.setOperatorRatio(k, ratios[k]);
+        v.setOperatorLevel(k, levels[k]);
+        v.setOperatorEnvelope(k, 0.05f + 0.02f * k, 0.6f);
+    }
+}
+
+std::vector<float> renderFM(VoiceFM& v, int total, int blockSize, int noteOffAt)
+{
+    std::vector<float> out(static_cast<size_t>(total), 0.0f);
+    for (int pos = 0; pos < total; pos += blockSize)
+    {
+        if (pos == noteOffAt)
+            v.noteOff();
+        v.render(out.data() + pos, std::min(blockSize, total - pos));
+    }
+    return out;
+}
+
+// Straightforward per-sample model: double-precision std::sin and
+// a runtime routing walk, sharing only the envelope shape.
+std::vector<float> renderReference(const VoiceFM& cfg, FMAlgorithm alg,
+                                   int total, int noteOffAt)
+{
+    const auto& r = VoiceFM::routings[static_cast<size_t>(alg)];
+    const double twoPi = SineTable::twoPi;
+
+    EnvelopeFM env[VoiceFM::numOps];
+    uint32_t   phase[VoiceFM::numOps] = {};
+    for (int k = 0; k < VoiceFM::numOps; ++k)
+    {
+        env[k].prepare(kSr);
+        env[k].setADSR(0.005f, 0.05f + 0.02f * k, 0.6f, 0.05f);
+        env[k].noteOn();
+    }
+
+    const float gain = VoiceFM::carrierGain(r.carriers);
+    double fb0 = 0.0, fb1 = 0.0;
+
+    std::vector<float> out(static_cast<size_t>(total), 0.0f);
+    for (int i = 0; i < total; ++i)
+    {
+        if (i == noteOffAt)
+            for (auto& e : env) e.noteOff();
+
+        double y[VoiceFM::numOps] = {};
+        for (int k = VoiceFM::numOps - 1; k >= 0; --k)
+        {
+            double pm = 0.0;
+            for (int j = 0; j < VoiceFM::numOps; ++j)
+                if ((r.modulators[static_cast<size_t>(k)] >> j) & 1u)
+                    pm += y[j];
+            if (k == VoiceFM::numOps - 1)
+                pm += 0.3 * 0.5 * (fb0 + fb1);
+
+            const double ph = twoPi * static_cast<double>(phase[k]) / SineTable::cycle;
+            y[k] = std::sin(ph + pm) * env[k].nextSample() * cfg.getOperatorLevel(k);
+        }
+
+        fb1 = fb0;
+        fb0 = y[VoiceFM::numOps - 1];
+
+        double s = 0.0;
+        for (int k = 0; k < VoiceFM::numOps; ++k)
+            if ((r.carriers >> k) & 1u)
+                s += y[k];
+        out[static_cast<size_t>(i)] = static_cast<float>(gain * s);
+
+        for (int k = 0; k < VoiceFM::numOps; ++k)
+            phase[k] += cfg.getPhaseIncrement(k);
+    }
+    return out;
+}
+
+} // namespace
+
+TEST_CASE("VoiceFM is created for VoiceMode::VoiceFM", "[voice][fm]")
+{
+    VoiceManager vm([] { return ParameterSnapshot{}; });
+    auto v = vm.makeVoiceForMode(VoiceMode::VoiceFM);
+    REQUIRE(dynamic_cast<VoiceFM*>(v.get()) != nullptr);
+}
+
+TEST_CASE("SineTable lookup tracks std::sin", "[voice][fm]")
+{
+    double maxErr = 0.0;
+    for (uint64_t p = 0; p < (1ull << 32); p += 104729ull)
+    {
+        const double ref = std::sin(SineTable::twoPi * static_cast<double>(p) / SineTable::cycle);
+        const double got = SineTable::lookup(static_cast<uint32_t>(p));
+        maxErr = std::max(maxErr, std::abs(ref - got));
+    }
+    REQUIRE(maxErr < 2.0e-6);
+
+    // Negative offsets wrap.
+    REQUIRE(SineTable::lookup(SineTable::radiansToPhase(-1.0f)) == Approx(std::sin(-1.0)).margin(1e-5));
+}
+
+TEST_CASE("EnvelopeFM block rendering matches per-sample rendering", "[voice][fm]")
+{
+    EnvelopeFM a, b;
+    for (auto* e : { &a, &b })
+    {
+        e->prepare(kSr);
+        e->setADSR(0.01f, 0.05f, 0.4f, 0.03f);
+        e->noteOn();
+    }
+
+    const int total = 6000;
+    std::vector<float> perSample(total), block(total);
+
+    for (int i = 0; i < total; ++i)
+    {
+        if (i == 3000) a.noteOff();
+        perSample[static_cast<size_t>(i)] = a.nextSample();
+    }
+
+    const int sizes[] = { 1, 7, 64, 333 };
+    int pos = 0, s = 0;
+    while (pos < total)
+    {
+        if (pos == 3000) b.noteOff();
+        int n = std::min(sizes[s++ % 4], total - pos);
+        if (pos < 3000 && pos + n > 3000) n = 3000 - pos;
+        b.renderBlock(block.data() + pos, n);
+        pos += n;
+    }
+
+    REQUIRE(perSample == block);
+    REQUIRE_FALSE(a.isActive());
+    REQUIRE(perSample[2999] == Approx(0.4f).margin(1e-4));   // settled at sustain
+}
+
+TEST_CASE("VoiceFM matches the golden reference model for every algorithm", "[voice][fm]")
+{
+    const int total     = 9600;
+    const int noteOffAt = 4800;
+
+    for (int a = 0; a < VoiceFM::numAlgorithms; ++a)
+    {
+        const auto alg = static_cast<FMAlgorithm>(a);
+
+        VoiceFM v;
+        configure(v, alg);
+        v.noteOn(fmSnapshot(), 57, 1.0f);
+
+        // 96 crosses the internal 64-sample chunk boundary.
+        const auto got = renderFM(v, total, 96, noteOffAt);
+        const auto ref = renderReference(v, alg, total, noteOffAt);
+
+        double maxErr = 0.0;
+        for (size_t i = 0; i < got.size(); ++i)
+            maxErr = std::max(maxErr, std::abs(static_cast<double>(got[i] - ref[i])));
+
+        INFO("algorithm " << a);
+        REQUIRE(computePeak(ref) > 0.1f);
+        REQUIRE(maxErr < 1.0e-4);
+    }
+}
+
+TEST_CASE("VoiceFM output does not depend on host block size", "[voice][fm]")
+{
+    std::vector<float> outputs[3];
+    const int blockSizes[3] = { 1, 37, 512 };
+
+    for (int b = 0; b < 3; ++b)
+    {
+        VoiceFM v;
+        configure(v, FMAlgorithm::DualMod);
+        v.noteOn(fmSnapshot(), 60, 1.0f);
+        outputs[b] = renderFM(v, 4096, blockSizes[b], -1);
+    }
+
+    REQUIRE(outputs[0] == outputs[1]);
+    REQUIRE(outputs[0] == outputs[2]);
+}
+
+TEST_CASE("VoiceFM parallel algorithm with one carrier is a pure sine", "[voice][fm]")
+{
+    VoiceFM v;
+    v.prepare(kSr);
+    v.setAlgorithm(FMAlgorithm::Parallel);
+    for (int k = 1; k < VoiceFM::numOps; ++k)
+        v.setOperatorLevel(k, 0.0f);
+    v.setOperatorLevel(0, 4.0f);   // ×¼ carrier gain → unit amplitude
+    v.setOperatorEnvelope(0, 0.0f, 1.0f);
+    v.noteOn(fmSnapshot(), 69, 1.0f);
+
+    auto out = renderFM(v, 4800, 256, -1);
+
+    // After the 5 ms attack the carrier is sin(2π·440·n/sr).
+    for (int i = 480; i < 4800; ++i)
+    {
+        const double ref = std::sin(SineTable::twoPi * 440.0 * i / kSr);
+        REQUIRE(out[static_cast<size_t>(i)] == Approx(ref).margin(1e-4));
+    }
+}
+
+TEST_CASE("VoiceFM deactivates after the carrier release", "[voice][fm]")
+{
+    VoiceFM v;
+    configure(v, FMAlgorithm::TwoStacks);
+    v.noteOn(fmSnapshot(), 60, 1.0f);
+
+    std::vector<float> block(256, 0.0f);
+    v.render(block.data(), 256);
+    REQUIRE(v.isActive());
+    REQUIRE(v.getCurrentLevel() > 0.0f);
+
+    v.noteOff();
+    for (int b = 0; b < 40 && v.isActive(); ++b)
+        v.render(block.data(), 256);
+
+    REQUIRE_FALSE(v.isActive());
+}
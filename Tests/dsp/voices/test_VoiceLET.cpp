@@ -0,0 +1,217 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/VoiceManager.h"
+#include "dsp/voices/VoiceLET.h"
+#include "params/ParameterSnapshot.h"
+#include "utils/dsp_metrics.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// ============================================================
+// VoiceLET — relativistic Doppler factor, Lorentz-dilated
+// envelope timebase, block-rate interpolation
+// ============================================================
+
+namespace {
+
+constexpr double kSr = 48000.0;
+
+// beta is v/c (snapshot); the listener speed scalar follows it so
+// the geometry matches the field VoiceDopp would render.
+void startNote(VoiceLET& v, double carrierHz, float beta, float headingNorm = 0.5f,
+               double pulseHz = 0.5)
+{
+    v.prepare(kSr);
+
+    ParameterSnapshot s;
+    s.oscFreq     = static_cast<float>(carrierHz);
+    s.envAttack   = 0.001f;
+    s.envRelease  = 0.2f;
+    s.relVelocity = beta;
+    v.noteOn(s, 69, 1.0f);
+
+    v.setAudioSynthesisEnabled(true);
+    v.setFieldPulseFrequencyForTest(pulseHz);
+    v.setListenerControls(beta, headingNorm);
+}
+
+std::vector<float> renderBlocks(VoiceLET& v, int numBlocks, int blockSize = 256)
+{
+    std::vector<float> out;
+    std::vector<float> block(static_cast<size_t>(blockSize));
+
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        std::fill(block.begin(), block.end(), 0.0f);
+        v.render(block.data(), blockSize);
+        out.insert(out.end(), block.begin(), block.end());
+    }
+    return out;
+}
+
+double peakFrequencyHz(const std::vector<float>& buf, double sr)
+{
+    const auto power = computePowerSpectrum(buf);
+    const auto it    = std::max_element(power.begin() + 1, power.end());
+    const double binHz = sr / (2.0 * static_cast<double>(power.size() - 1));
+    return static_cast<double>(std::distance(power.begin(), it)) * binHz;
+}
+
+} // namespace
+
+TEST_CASE("VoiceLET is created for VoiceMode::VoiceLET", "[voice][let]")
+{
+    VoiceManager vm([] { return ParameterSnapshot{}; });
+
+    auto v = vm.makeVoiceForMode(VoiceMode::VoiceLET);
+    REQUIRE(dynamic_cast<VoiceLET*>(v.get()) != nullptr);
+
+    // Shares the VoiceDopp engine, so Dopp-specific dispatch applies.
+    REQUIRE(dynamic_cast<VoiceDopp*>(v.get()) != nullptr);
+}
+
+TEST_CASE("VoiceLET closed-form gamma and Doppler ratio", "[voice][let]")
+{
+    REQUIRE(VoiceLET::computeLorentzGamma(0.0) == Approx(1.0));
+    REQUIRE(VoiceLET::computeLorentzGamma(0.6) == Approx(1.25));
+
+    REQUIRE(VoiceLET::computeRelativisticDoppler(0.0)  == Approx(1.0));
+    REQUIRE(VoiceLET::computeRelativisticDoppler(0.6)  == Approx(2.0));
+    REQUIRE(VoiceLET::computeRelativisticDoppler(-0.6) == Approx(0.5));
+
+    // v/c is clamped below 1, so both stay finite at and beyond c.
+    const double gMax = 1.0 / std::sqrt(1.0 - VoiceLET::betaMax * VoiceLET::betaMax);
+    REQUIRE(VoiceLET::computeLorentzGamma(1.0) == Approx(gMax));
+    REQUIRE(VoiceLET::computeLorentzGamma(5.0) == Approx(gMax));
+    REQUIRE(std::isfinite(VoiceLET::computeRelativisticDoppler(1.0)));
+
+    VoiceLET v;
+    startNote(v, 440.0, 1.0f);
+    REQUIRE(v.getBeta() == Approx(VoiceLET::betaMax));
+}
+
+TEST_CASE("VoiceLET at rest plays the base frequency", "[voice][let]")
+{
+    VoiceLET v;
+    startNote(v, 1000.0, 0.0f);
+
+    auto out = renderBlocks(v, 160);
+
+    REQUIRE(v.getBlockDopplerRatio() == Approx(1.0));
+    REQUIRE(v.getLorentzGamma()      == Approx(1.0));
+    REQUIRE(computePeak(out) > 0.0f);
+
+    const double binHz = kSr / 32768.0;
+    REQUIRE(std::abs(peakFrequencyHz(out, kSr) - 1000.0) <= 2.0 * binHz);
+}
+
+TEST_CASE("VoiceLET shifts the carrier by the relativistic ratio", "[voice][let]")
+{
+    VoiceLET v;
+    startNote(v, 1000.0, 0.6f);
+
+    // Without time accumulation the listener stays put, so D is
+    // constant after the first block.
+    renderBlocks(v, 4);
+    auto out = renderBlocks(v, 160);
+
+    const double D    = v.getBlockDopplerRatio();
+    const double beta = v.getBeta();
+
+    REQUIRE(D >= VoiceLET::computeRelativisticDoppler(-beta) - 1e-9);
+    REQUIRE(D <= VoiceLET::computeRelativisticDoppler(beta)  + 1e-9);
+
+    const double binHz = kSr / 32768.0;
+    REQUIRE(std::abs(peakFrequencyHz(out, kSr) - 1000.0 * D) <= 2.0 * binHz);
+}
+
+TEST_CASE("VoiceLET envelope runs on dilated proper time", "[voice][let]")
+{
+    VoiceLET v;
+    startNote(v, 440.0, 0.6f);
+
+    constexpr int blockSize = 240;
+    constexpr int numBlocks = 200;   // 1 s
+    renderBlocks(v, numBlocks, blockSize);
+
+    const double T = numBlocks * blockSize / kSr;
+    const double gamma = v.getLorentzGamma();
+    REQUIRE(gamma == Approx(1.25));
+    REQUIRE(v.getEnvelopeTimeSec() == Approx(T / gamma).epsilon(1e-9));
+}
+
+TEST_CASE("VoiceLET glides across blocks when speed jumps", "[voice][let]")
+{
+    VoiceLET v;
+    startNote(v, 440.0, 0.0f);
+
+    constexpr int blockSize = 256;
+    auto before = renderBlocks(v, 8, blockSize);
+
+    // Jump to near-c between blocks (v/c and the listener speed).
+    v.handleController(5, 0.9f);
+    v.handleController(6, 0.9f);
+    auto after = renderBlocks(v, 8, blockSize);
+
+    // The ratio reached at the end of the first post-jump block is the
+    // new one, but the block itself ramps from the old value.
+    REQUIRE(v.getBlockDopplerRatio() != Approx(1.0));
+
+    std::vector<float> all = before;
+    all.insert(all.end(), after.begin(), after.end());
+
+    const double peak   = static_cast<double>(computePeak(all));
+    const double dMax   = VoiceLET::computeRelativisticDoppler(0.9);
+    const double maxInc = juce::MathConstants<double>::twoPi * 440.0 * dMax / kSr;
+
+    double maxStep = 0.0;
+    for (size_t i = 1; i < all.size(); ++i)
+        maxStep = std::max(maxStep, std::abs(static_cast<double>(all[i] - all[i - 1])));
+
+    // A sinusoid of amplitude A never moves more than A·ω per sample.
+    REQUIRE(peak > 0.0);
+    REQUIRE(maxStep <= peak * maxInc * 1.05);
+}
+
+TEST_CASE("VoiceLET takes v/c from the snapshot and control 6", "[voice][let]")
+{
+    VoiceLET v;
+    startNote(v, 440.0, 0.6f);
+    REQUIRE(v.getBeta() == Approx(0.6));
+
+    v.handleController(6, 0.3f);
+    REQUIRE(v.getBeta() == Approx(0.3));
+
+    // CC5 moves the listener but no longer sets v/c.
+    v.handleController(5, 0.9f);
+    REQUIRE(v.getBeta() == Approx(0.3));
+
+    // The manager carries the latest control 6 into every snapshot.
+    VoiceManager vm([] { return ParameterSnapshot{}; });
+    vm.prepare(kSr);
+    vm.handleController(6, 0.5f);
+    vm.flushControllers();
+    vm.startBlock();
+    REQUIRE(vm.getCurrentSnapshot() != nullptr);
+    REQUIRE(vm.getCurrentSnapshot()->relVelocity == Approx(0.5f));
+}
+
+TEST_CASE("VoiceLET Nyquist guard covers the pulse sidebands", "[voice][let]")
+{
+    // Carrier alone sits below the fade; carrier + pulse is past Nyquist.
+    VoiceLET v;
+    startNote(v, 20000.0, 0.0f, 0.5f, 5000.0);
+
+    REQUIRE(v.topPartialHz(1.0) == Approx(25000.0));
+
+    auto out = renderBlocks(v, 16);
+    REQUIRE(computePeak(out) == 0.0f);
+
+    // With a slow pulse the same carrier is audible.
+    VoiceLET slow;
+    startNote(slow, 20000.0, 0.0f, 0.5f, 0.5);
+    REQUIRE(computePeak(renderBlocks(slow, 16)) > 0.0f);
+}
@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+using Catch::Approx;
+
+#include "dsp/voices/VoiceA.h"
+#include "dsp/voices/VoiceDopp.h"
+#include "dsp/DspTables.h"
+#include "params/ParameterSnapshot.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// ============================================================
+// Velocity / key-tracking gain, applied once at noteOn
+// ============================================================
+
+namespace {
+
+template <typename Voice>
+std::vector<float> renderNote(const ParameterSnapshot& snap, int note, float velocity,
+                              bool dopplerAudio = false)
+{
+    Voice v;
+    v.prepare(48000.0);
+    v.noteOn(snap, note, velocity);
+    if constexpr (std::is_base_of_v<VoiceDopp, Voice>)
+    {
+        v.setAudioSynthesisEnabled(dopplerAudio);
+        v.setListenerControls(0.6f, 0.5f);
+    }
+
+    std::vector<float> out(1024, 0.0f);
+    v.render(out.data(), static_cast<int>(out.size()));
+    return out;
+}
+
+float ratioOf(const std::vector<float>& a, const std::vector<float>& b)
+{
+    // Same signal up to a constant: compare at the largest sample of b.
+    const auto it = std::max_element(b.begin(), b.end(),
+                                     [](float x, float y) { return std::fabs(x) < std::fabs(y); });
+    const auto i  = static_cast<size_t>(it - b.begin());
+    return a[i] / b[i];
+}
+
+} // namespace
+
+TEST_CASE("VoiceA: velocity curve scales the note by its table gain", "[voice][velocity]")
+{
+    ParameterSnapshot snap;
+    snap.envAttack = 0.001f;
+
+    const auto full = renderNote<VoiceA>(snap, 60, 1.0f);
+
+    for (int c = 0; c < numVelocityCurves; ++c)
+    {
+        snap.velCurve = static_cast<VelocityCurve>(c);
+        const auto soft = renderNote<VoiceA>(snap, 60, 0.5f);
+
+        const float expected = DspTables::get().velocityGain(snap.velCurve, 0.5f);
+        REQUIRE(ratioOf(soft, full) == Approx(expected).epsilon(1e-5));
+    }
+}
+
+TEST_CASE("VoiceA: key tracking follows dB per octave", "[voice][velocity]")
+{
+    ParameterSnapshot snap;
+    snap.velCurve   = VelocityCurve::Fixed;
+    snap.keyTrackDb = -6.0f;
+
+    VoiceA low, high;
+    low.prepare(48000.0);
+    high.prepare(48000.0);
+    low.noteOn(snap, 48, 0.3f);
+    high.noteOn(snap, 72, 0.3f);
+
+    REQUIRE(low.getNoteGain()  == Approx(std::pow(10.0f,  6.0f / 20.0f)).epsilon(1e-4));
+    REQUIRE(high.getNoteGain() == Approx(std::pow(10.0f, -6.0f / 20.0f)).epsilon(1e-4));
+}
+
+TEST_CASE("VoiceDopp: velocity gain is folded into the attenuation", "[voice][velocity][dopp]")
+{
+    ParameterSnapshot snap;
+    snap.velCurve = VelocityCurve::Hard;
+
+    const auto full = renderNote<VoiceDopp>(snap, 69, 1.0f, true);
+    const auto soft = renderNote<VoiceDopp>(snap, 69, 0.5f, true);
+
+    REQUIRE(std::any_of(full.begin(), full.end(), [](float x) { return x != 0.0f; }));
+
+    const float expected = DspTables::get().velocityGain(VelocityCurve::Hard, 0.5f);
+    REQUIRE(ratioOf(soft, full) == Approx(expected).epsilon(1e-4));
+}
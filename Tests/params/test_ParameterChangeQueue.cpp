@@ -0,0 +1,72 @@
+#include <catch2/catch_test_macros.hpp>
+#include "params/ParameterChangeQueue.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// ============================================================
+// ParameterChangeQueue — SPSC audio → message thread hand-off
+// ============================================================
+
+TEST_CASE("ParameterChangeQueue: drains in push order", "[params][queue]")
+{
+    ParameterChangeQueue q;
+    REQUIRE(q.size() == 0);
+
+    REQUIRE(q.push({ 1, 0.25f, 1 }));
+    REQUIRE(q.push({ 2, 0.50f, 2 }));
+    REQUIRE(q.push({ 1, 0.75f, 3 }));
+    REQUIRE(q.size() == 3);
+
+    std::vector<ParameterChange> seen;
+    REQUIRE(q.drain([&](const ParameterChange& c) { seen.push_back(c); }) == 3);
+
+    REQUIRE(seen.size() == 3);
+    REQUIRE(seen[0].index == 1);
+    REQUIRE(seen[1].index == 2);
+    REQUIRE(seen[2].value == 0.75f);
+    REQUIRE(seen[2].seq == 3);
+    REQUIRE(q.size() == 0);
+}
+
+TEST_CASE("ParameterChangeQueue: a full ring rejects instead of blocking", "[params][queue]")
+{
+    ParameterChangeQueue q;
+
+    for (size_t i = 0; i < ParameterChangeQueue::capacity; ++i)
+        REQUIRE(q.push({ 0, 0.0f, static_cast<uint32_t>(i) }));
+
+    REQUIRE_FALSE(q.push({ 0, 1.0f, 0 }));
+
+    q.drain([](const ParameterChange&) {});
+    REQUIRE(q.push({ 0, 1.0f, 0 }));
+}
+
+TEST_CASE("ParameterChangeQueue: concurrent producer and consumer", "[params][queue]")
+{
+    ParameterChangeQueue q;
+    constexpr uint32_t total = 200000;
+
+    std::thread producer([&]
+    {
+        for (uint32_t seq = 1; seq <= total; )
+            if (q.push({ static_cast<int>(seq % 9), 0.5f, seq }))
+                ++seq;
+    });
+
+    uint32_t expected = 1;
+    bool inOrder = true;
+    while (expected <= total)
+    {
+        q.drain([&](const ParameterChange& c)
+        {
+            inOrder = inOrder && c.seq == expected && c.index == static_cast<int>(expected % 9);
+            ++expected;
+        });
+    }
+
+    producer.join();
+    REQUIRE(inOrder);
+    REQUIRE(q.size() == 0);
+}
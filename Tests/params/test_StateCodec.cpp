@@ -0,0 +1,108 @@
+#include <catch2/catch_test_macros.hpp>
+#include "params/StateCodec.h"
+
+#include <string>
+#include <vector>
+
+// ============================================================
+// StateCodec — binary plugin state
+// ============================================================
+
+namespace {
+
+std::vector<uint8_t> encode(const std::vector<StateCodec::ParamValue>& params, const ControllerMap& map)
+{
+    std::vector<uint8_t> blob(StateCodec::measure(params.data(), params.size(), map));
+    const size_t written = StateCodec::write(blob.data(), params.data(), params.size(), map);
+    REQUIRE(written == blob.size());
+    return blob;
+}
+
+} // namespace
+
+TEST_CASE("StateCodec: parameters and controller map round-trip", "[params][state]")
+{
+    const std::vector<StateCodec::ParamValue> params = {
+        { "master/volume", -12.5f },
+        { "voice/mode",      3.0f },
+        { "env/release",     0.75f },
+    };
+
+    auto map = ControllerMap::makeDefault();
+    map.learn(21, CcTarget::EnvAttack);
+    map.setRoute(22, CcRoute { CcTarget::MasterMix, CcCurve::Root, 0.2f, 0.9f });
+
+    const auto blob = encode(params, map);
+    REQUIRE(StateCodec::isBinaryState(blob.data(), blob.size()));
+
+    const StateCodec::Reader reader(blob.data(), blob.size());
+    REQUIRE(reader.isValid());
+    REQUIRE(reader.getVersion() == StateCodec::version);
+    REQUIRE(reader.getNumParams() == 3);
+
+    std::vector<std::pair<std::string, float>> seen;
+    reader.forEachParam([&](std::string_view id, float v) { seen.emplace_back(std::string(id), v); });
+
+    REQUIRE(seen.size() == 3);
+    REQUIRE(seen[0].first == "master/volume");
+    REQUIRE(seen[0].second == -12.5f);
+    REQUIRE(seen[2].first == "env/release");
+    REQUIRE(seen[2].second == 0.75f);
+
+    ControllerMap restored;
+    REQUIRE(reader.readControllerMap(restored));
+    REQUIRE(restored == map);
+}
+
+TEST_CASE("StateCodec: IDs are views into the blob", "[params][state]")
+{
+    const std::vector<StateCodec::ParamValue> params = { { "osc/freq", 440.0f } };
+    const auto blob = encode(params, ControllerMap {});
+
+    const StateCodec::Reader reader(blob.data(), blob.size());
+    reader.forEachParam([&](std::string_view id, float)
+    {
+        const auto* begin = reinterpret_cast<const char*>(blob.data());
+        REQUIRE(id.data() >= begin);
+        REQUIRE(id.data() + id.size() <= begin + blob.size());
+    });
+}
+
+TEST_CASE("StateCodec: truncated, foreign and future blobs are rejected", "[params][state]")
+{
+    const std::vector<StateCodec::ParamValue> params = {
+        { "master/volume", -6.0f },
+        { "master/mix",     1.0f },
+    };
+    const auto blob = encode(params, ControllerMap::makeDefault());
+
+    // Every truncation fails validation instead of over-reading.
+    for (size_t n = 0; n < blob.size(); ++n)
+        REQUIRE_FALSE(StateCodec::Reader(blob.data(), n).isValid());
+
+    // copyXmlToBinary() output starts with a different magic.
+    const uint8_t xmlBlob[] = { 0x56, 0x43, 0x32, 0x21, 0x10, 0, 0, 0, '<', '?', 'x', 'm', 'l', ' ', 'v', 'e' };
+    REQUIRE_FALSE(StateCodec::isBinaryState(xmlBlob, sizeof xmlBlob));
+
+    auto future = blob;
+    future[4] = static_cast<uint8_t>(StateCodec::version + 1);
+    REQUIRE_FALSE(StateCodec::Reader(future.data(), future.size()).isValid());
+}
+
+TEST_CASE("StateCodec: routes to unknown targets are dropped", "[params][state]")
+{
+    ControllerMap map;
+    map.learn(10, CcTarget::OscFreq);
+    map.learn(11, CcTarget::MasterMix);
+
+    auto blob = encode({}, map);
+
+    // Routes are the last 2 × 12 bytes; corrupt the first one's target.
+    blob[blob.size() - 2 * StateCodec::routeBytes + 1] = 200;
+
+    const StateCodec::Reader reader(blob.data(), blob.size());
+    ControllerMap restored;
+    REQUIRE(reader.readControllerMap(restored));
+    REQUIRE(restored.route(10).target == CcTarget::None);
+    REQUIRE(restored.route(11).target == CcTarget::MasterMix);
+}
@@ -38,3 +38,34 @@ TEST_CASE("APVTS layout contains master volume")
 
     REQUIRE(apvts.getParameter(ParameterIDs::masterVolume) != nullptr);
 }
+
+TEST_CASE("APVTS layout registers a parameter group per voice")
+{
+    MinimalProcessor proc;
+    juce::AudioProcessorValueTreeState apvts (proc, nullptr, "State", createParameterLayout());
+
+    for (int v = 0; v < NUM_VOICES; ++v)
+    {
+        for (int k = 0; k < numVoiceParams; ++k)
+        {
+            const auto id = voiceParamID(v, k);
+            auto* param = apvts.getParameter(id);
+
+            REQUIRE(param != nullptr);
+            REQUIRE(apvts.getRawParameterValue(id)->load() == voiceParamDescriptors[k].defaultValue);
+        }
+    }
+
+    REQUIRE(voiceParamID(1, voiceParamEnvAttack) == "voices/voice2/env/attack");
+
+    // Groups sit at the top level of the processor's parameter tree.
+    int numVoiceGroups = 0;
+    for (auto* group : proc.getParameterTree().getSubgroups(false))
+        if (group->getID().startsWith(ParameterIDs::voiceGroupPrefix))
+        {
+            ++numVoiceGroups;
+            REQUIRE(group->getParameters(false).size() == numVoiceParams);
+        }
+
+    REQUIRE(numVoiceGroups == NUM_VOICES);
+}
@@ -0,0 +1,106 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "plugin/PluginProcessor.h"
+#include "params/ParameterIDs.h"
+
+using Catch::Approx;
+
+// ============================================================
+// CC-driven host parameters: the audio thread only queues
+// ============================================================
+
+namespace {
+
+float rawParam(MIDIControl001AudioProcessor& proc, const char* id)
+{
+    return proc.apvts.getRawParameterValue(id)->load();
+}
+
+float absMax(const juce::AudioBuffer<float>& buf)
+{
+    float m = 0.0f;
+    for (int ch = 0; ch < buf.getNumChannels(); ++ch)
+        for (int i = 0; i < buf.getNumSamples(); ++i)
+            m = std::max(m, std::abs(buf.getSample(ch, i)));
+    return m;
+}
+
+} // namespace
+
+TEST_CASE("Processor: CC reaches DSP at once and APVTS on the message thread", "[processor][cc]")
+{
+    MIDIControl001AudioProcessor proc;
+    proc.prepareToPlay(48000.0, 256);
+
+    juce::AudioBuffer<float> buffer(2, 256);
+    juce::MidiBuffer midi;
+
+    // Sound a note at the default -6 dB.
+    midi.addEvent(juce::MidiMessage::noteOn(1, 69, (juce::uint8) 127), 0);
+    for (int n = 0; n < 8; ++n)
+    {
+        proc.processBlock(buffer, midi);
+        midi.clear();
+    }
+    const float before = absMax(buffer);
+    REQUIRE(before > 0.0f);
+
+    // CC1 → master volume fully down (-60 dB).
+    midi.addEvent(juce::MidiMessage::controllerEvent(1, 1, 0), 0);
+    proc.processBlock(buffer, midi);
+    midi.clear();
+
+    // Audible in this block, but APVTS is untouched until the
+    // message thread drains the queue.
+    REQUIRE(absMax(buffer) < before * 0.01f);
+    REQUIRE(rawParam(proc, ParameterIDs::masterVolume) == Approx(-6.0f));
+
+    proc.flushHostParameterChanges();
+    REQUIRE(rawParam(proc, ParameterIDs::masterVolume) == Approx(-60.0f));
+
+    // After the hand-off the block follows APVTS again (host automation).
+    proc.apvts.getParameterAsValue(ParameterIDs::masterVolume).setValue(-6.0f);
+    proc.processBlock(buffer, midi);
+    proc.processBlock(buffer, midi);
+    REQUIRE(absMax(buffer) > before * 0.5f);
+}
+
+TEST_CASE("Processor: every queued CC of a dense stream reaches APVTS", "[processor][cc]")
+{
+    constexpr int blockSize  = 256;
+    constexpr int numBlocks  = 40;
+    constexpr int ccPerBlock = 53;   // 10 kHz of CC at 48 kHz
+
+    MIDIControl001AudioProcessor proc;
+    proc.prepareToPlay(48000.0, blockSize);
+
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+
+    for (int n = 0; n < 8; ++n)
+        midi.addEvent(juce::MidiMessage::noteOn(1, 60 + n, (juce::uint8) 100), 0);
+    proc.processBlock(buffer, midi);
+
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        midi.clear();
+        for (int m = 0; m < ccPerBlock; ++m)
+            midi.addEvent(juce::MidiMessage::controllerEvent(1, 1 + m % 5, (b + m) % 128),
+                          m * blockSize / ccPerBlock);
+
+        proc.processBlock(buffer, midi);
+
+        // UI-rate drain (~30 Hz).
+        if (b % 6 == 0)
+            proc.flushHostParameterChanges();
+    }
+
+    // The last CC1 of the last block wins.
+    proc.flushHostParameterChanges();
+    const int lastVolume = (numBlocks - 1 + ((ccPerBlock - 1) / 5) * 5) % 128;
+    REQUIRE(rawParam(proc, ParameterIDs::masterVolume)
+            == Approx(-60.0f + 60.0f * lastVolume / 127.0f).margin(0.01f));
+}
@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "plugin/PluginProcessor.h"
+#include "params/ParameterIDs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+// ============================================================
+// Many processors in one process, processed concurrently
+// ------------------------------------------------------------
+// Each instance gets its own note / CC script. Rendered alone and
+// rendered alongside 63 others on a pool of worker threads, every
+// instance must produce bit-identical output — any state shared
+// between instances (function-local statics and the like) shows up
+// here as a mismatch.
+// ============================================================
+
+namespace {
+
+constexpr int numInstances = 64;
+constexpr int blockSize    = 256;
+constexpr int numBlocks    = 24;
+
+// Instance-specific script: note, CC3/CC5 moves, note off.
+void fillMidi(int instance, int block, juce::MidiBuffer& midi)
+{
+    midi.clear();
+    const int note = 40 + instance % 40;
+
+    if (block == 0)
+        midi.addEvent(juce::MidiMessage::noteOn(1, note, (juce::uint8) (60 + instance % 60)), instance % blockSize);
+    if (block % 3 == 1)
+        midi.addEvent(juce::MidiMessage::controllerEvent(1, 3 + block % 2 * 2, (block * 7 + instance) % 128), 17);
+    if (block == numBlocks - 8)
+        midi.addEvent(juce::MidiMessage::noteOff(1, note), 5);
+}
+
+struct Instance
+{
+    std::unique_ptr<MIDIControl001AudioProcessor> proc;
+    juce::AudioBuffer<float> buffer { 2, blockSize };
+    juce::MidiBuffer midi;
+    std::vector<float> out;
+    int index = 0;
+
+    explicit Instance(int i) : proc(std::make_unique<MIDIControl001AudioProcessor>()), index(i)
+    {
+        proc->apvts.getParameterAsValue(ParameterIDs::masterVolume).setValue(-0.25f * static_cast<float>(i % 24));
+        proc->prepareToPlay(48000.0, blockSize);
+        out.reserve(static_cast<size_t>(blockSize * numBlocks));
+    }
+
+    void processBlock(int block)
+    {
+        fillMidi(index, block, midi);
+        proc->processBlock(buffer, midi);
+        out.insert(out.end(), buffer.getReadPointer(0), buffer.getReadPointer(0) + blockSize);
+    }
+};
+
+// Block-synchronous host: every worker pulls instances off a shared
+// counter for block b, then all move on to b + 1.
+void processConcurrently(std::vector<std::unique_ptr<Instance>>& session, int numThreads)
+{
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        std::atomic<int> next { 0 };
+        std::vector<std::thread> pool;
+
+        for (int t = 0; t < numThreads; ++t)
+            pool.emplace_back([&]
+            {
+                for (int i = next++; i < static_cast<int>(session.size()); i = next++)
+                    session[static_cast<size_t>(i)]->processBlock(b);
+            });
+
+        for (auto& th : pool)
+            th.join();
+    }
+}
+
+} // namespace
+
+TEST_CASE("Processor: 64 concurrent instances render as if alone", "[processor][multi-instance]")
+{
+    // Reference: each instance rendered on its own.
+    std::vector<std::vector<float>> reference;
+    for (int i = 0; i < numInstances; ++i)
+    {
+        Instance solo(i);
+        for (int b = 0; b < numBlocks; ++b)
+            solo.processBlock(b);
+        reference.push_back(solo.out);
+    }
+
+    std::vector<std::unique_ptr<Instance>> session;
+    for (int i = 0; i < numInstances; ++i)
+        session.push_back(std::make_unique<Instance>(i));
+
+    const int numThreads = std::max(2, std::min(8, static_cast<int>(std::thread::hardware_concurrency())));
+    processConcurrently(session, numThreads);
+
+    int mismatches = 0;
+    for (int i = 0; i < numInstances; ++i)
+        mismatches += session[static_cast<size_t>(i)]->out != reference[static_cast<size_t>(i)] ? 1 : 0;
+
+    REQUIRE(mismatches == 0);
+
+    // Scripts differ, so instances must not all sound alike.
+    REQUIRE(reference[0] != reference[1]);
+}
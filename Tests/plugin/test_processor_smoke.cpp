@@ -107,3 +107,62 @@ TEST_CASE("Processor state save/restore preserves parameters", "[apvts][state]")
     // ---- verify restored value
     CHECK(getParam(*proc2, ParameterIDs::masterVolume) == Approx(-12.0f).margin(1e-6f));
 }
+
+TEST_CASE("Processor state save/restore preserves the controller map", "[apvts][state][cc]")
+{
+    auto proc1 = makeProc();
+    proc1->learnController(21, CcTarget::EnvAttack);
+
+    auto map = proc1->getControllerMap();
+    map.setRoute(22, CcRoute { CcTarget::MasterMix, CcCurve::Root, 0.2f, 0.9f });
+    proc1->setControllerMap(map);
+
+    const auto state = saveState(*proc1);
+
+    auto proc2 = makeProc();
+    CHECK(proc2->getControllerMap() == ControllerMap::makeDefault());
+
+    loadState(*proc2, state);
+
+    const auto restored = proc2->getControllerMap();
+    CHECK(restored == map);
+    CHECK(restored.route(3).target == CcTarget::None);   // released by learn
+    CHECK(restored.route(22).curve == CcCurve::Root);
+
+    // The map is not an APVTS parameter subtree.
+    CHECK(!proc2->apvts.state.getChildWithName("CC_MAP").isValid());
+}
+
+TEST_CASE("Processor restores XML state from older sessions", "[apvts][state][xml]")
+{
+    // The pre-binary format: APVTS (+ CC_MAP child) via copyXmlToBinary.
+    auto proc1 = makeProc();
+    setParamVT(*proc1, ParameterIDs::masterVolume, -18.0f);
+
+    auto tree = proc1->apvts.copyState();
+    juce::ValueTree ccMap("CC_MAP");
+    juce::ValueTree route("ROUTE");
+    route.setProperty("cc", 30, nullptr);
+    route.setProperty("target", ParameterIDs::oscFreq, nullptr);
+    route.setProperty("curve", "squared", nullptr);
+    route.setProperty("lo", 0.0f, nullptr);
+    route.setProperty("hi", 1.0f, nullptr);
+    ccMap.appendChild(route, nullptr);
+    tree.appendChild(ccMap, nullptr);
+
+    juce::MemoryBlock xmlState;
+    juce::AudioProcessor::copyXmlToBinary(*tree.createXml(), xmlState);
+
+    auto proc2 = makeProc();
+    loadState(*proc2, xmlState);
+
+    CHECK(getParam(*proc2, ParameterIDs::masterVolume) == Approx(-18.0f).margin(1e-6f));
+    CHECK(proc2->getControllerMap().route(30).target == CcTarget::OscFreq);
+    CHECK(proc2->getControllerMap().route(30).curve == CcCurve::Squared);
+    CHECK(proc2->getControllerMap().route(5).target == CcTarget::None);
+
+    // Saved again, it comes out in the binary format.
+    const auto binary = saveState(*proc2);
+    CHECK(StateCodec::isBinaryState(binary.getData(), binary.getSize()));
+    CHECK(binary.getSize() < xmlState.getSize());
+}
@@ -0,0 +1,52 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <juce_audio_processors/juce_audio_processors.h>
+
+#include "plugin/PluginProcessor.h"
+#include "dsp/voices/VoiceA.h"
+#include <memory>
+#include <vector>
+
+// ============================================================
+// Instantiation cost: a project with 50 instances must not stall.
+// Construction builds no voices; prepareToPlay builds the pool
+// (a few microseconds), so the first note builds nothing on the
+// audio thread. (Timings: test_bench_startup.)
+// ============================================================
+
+TEST_CASE("Processor builds voices in prepare, never at note-on", "[plugin][startup]")
+{
+    constexpr int numInstances = 50;
+
+    std::vector<std::unique_ptr<MIDIControl001AudioProcessor>> procs;
+    std::vector<int> built(numInstances, 0);
+
+    for (int i = 0; i < numInstances; ++i)
+    {
+        procs.push_back(std::make_unique<MIDIControl001AudioProcessor>());
+        procs.back()->setVoiceFactory([&built, i](VoiceMode) -> std::unique_ptr<BaseVoice> {
+            ++built[static_cast<size_t>(i)];
+            return std::make_unique<VoiceA>();
+        });
+    }
+
+    for (int n : built)
+        CHECK(n == 0);
+
+    for (auto& p : procs)
+        p->prepareToPlay(48'000.0, 512);
+
+    for (int n : built)
+        CHECK(n > 0);
+
+    // The first block with a note renders from the prepared pool.
+    const int builtAtPrepare = built.front();
+
+    juce::AudioBuffer<float> buffer(2, 512);
+    juce::MidiBuffer midi;
+    midi.addEvent(juce::MidiMessage::noteOn(1, 60, 1.0f), 0);
+    procs.front()->processBlock(buffer, midi);
+
+    CHECK(built.front() == builtAtPrepare);
+    CHECK(buffer.getMagnitude(0, 512) > 0.0f);
+}
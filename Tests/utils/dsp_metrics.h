@@ -7,6 +7,7 @@
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <complex>
 #include <nlohmann/json.hpp>
 
 // ============================================================
@@ -129,3 +130,93 @@ inline bool compareWithBaseline(const std::string& filename,
               << fs::absolute(inPath) << "\n";
     return true;
 }
+
+// ============================================================
+// Spectral metrics: magnitude spectrum / band energy / aliasing
+// ============================================================
+
+// Hann-windowed power spectrum via an in-place radix-2 FFT.
+// Uses the largest power-of-two prefix of buf. Bin k ↔ k·sr/N Hz.
+inline std::vector<double> computePowerSpectrum(const std::vector<float>& buf)
+{
+    size_t n = 1;
+    while (n * 2 <= buf.size())
+        n *= 2;
+
+    std::vector<std::complex<double>> x(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const double w = 0.5 - 0.5 * std::cos(2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n));
+        x[i] = { w * buf[i], 0.0 };
+    }
+
+    // bit reversal
+    for (size_t i = 1, j = 0; i < n; ++i)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(x[i], x[j]);
+    }
+
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        const double ang = -2.0 * M_PI / static_cast<double>(len);
+        const std::complex<double> wl(std::cos(ang), std::sin(ang));
+        for (size_t i = 0; i < n; i += len)
+        {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < len / 2; ++k)
+            {
+                const auto u = x[i + k];
+                const auto v = x[i + k + len / 2] * w;
+                x[i + k]           = u + v;
+                x[i + k + len / 2] = u - v;
+                w *= wl;
+            }
+        }
+    }
+
+    std::vector<double> power(n / 2 + 1);
+    for (size_t k = 0; k < power.size(); ++k)
+        power[k] = std::norm(x[k]);
+    return power;
+}
+
+// Energy in [loHz, hiHz] of a power spectrum computed at sampleRate.
+inline double bandEnergy(const std::vector<double>& power, double sampleRate, double loHz, double hiHz)
+{
+    const double binHz = sampleRate / (2.0 * static_cast<double>(power.size() - 1));
+    double e = 0.0;
+    for (size_t k = 0; k < power.size(); ++k)
+    {
+        const double f = static_cast<double>(k) * binHz;
+        if (f >= loHz && f <= hiHz)
+            e += power[k];
+    }
+    return e;
+}
+
+// Ratio (dB) of the energy outside ±toleranceHz around the expected
+// partials to the energy inside them. Lower is cleaner; aliasing
+// shows up as energy at folded frequencies away from the partials.
+inline double aliasingRatioDb(const std::vector<float>& buf,
+                              double sampleRate,
+                              const std::vector<double>& expectedHz,
+                              double toleranceHz)
+{
+    const auto power = computePowerSpectrum(buf);
+
+    double total = 0.0;
+    for (double p : power)
+        total += p;
+
+    double wanted = 0.0;
+    for (double f : expectedHz)
+        wanted += bandEnergy(power, sampleRate, f - toleranceHz, f + toleranceHz);
+
+    const double unwanted = std::max(total - wanted, 1e-30);
+    return 10.0 * std::log10(unwanted / std::max(wanted, 1e-30));
+}